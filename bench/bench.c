@@ -0,0 +1,168 @@
+/**
+ * @file bench.c
+ * @brief Реализация замера и отчетов микробенчмарков.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+volatile unsigned long benchSink;
+bool benchFailed;
+
+static double elapsedSeconds(const struct timespec* start) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)(now.tv_sec - start->tv_sec) +
+         (double)(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static double sampleSeconds(const BenchCase_t* item, void* state,
+                            unsigned long iterations) {
+  struct timespec start;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  item->run(state, iterations);
+  return elapsedSeconds(&start);
+}
+
+static int compareDoubles(const void* a, const void* b) {
+  double x = *(const double*)a;
+  double y = *(const double*)b;
+
+  return (x > y) - (x < y);
+}
+
+// Медиана упорядочивает массив.
+static double median(double* values, int count) {
+  qsort(values, (size_t)count, sizeof(double), compareDoubles);
+  return count % 2 ? values[count / 2]
+                   : (values[count / 2 - 1] + values[count / 2]) / 2;
+}
+
+static void summarize(double* samples, int count, BenchResult_t* result) {
+  double* deviations = samples + count;
+
+  result->median = median(samples, count);
+  result->min = samples[0];
+  result->max = samples[count - 1];
+  for (int i = 0; i < count; i++) {
+    double deviation = samples[i] - result->median;
+    deviations[i] = deviation < 0 ? -deviation : deviation;
+  }
+  result->mad = median(deviations, count);
+}
+
+void initBenchConfig(BenchConfig_t* config) {
+  config->warmup = BENCH_WARMUP;
+  config->repetitions = BENCH_REPETITIONS;
+  config->sampleSeconds = BENCH_SAMPLE_MS / 1e3;
+  config->filter = NULL;
+}
+
+bool isValidBenchConfig(const BenchConfig_t* config) {
+  return config && config->warmup >= 0 && config->repetitions > 0 &&
+         config->repetitions <= BENCH_MAX_REPETITIONS &&
+         config->sampleSeconds > 0;
+}
+
+bool isBenchCaseSelected(const BenchConfig_t* config,
+                         const BenchCase_t* item) {
+  return !config->filter || strstr(item->name, config->filter);
+}
+
+int runBenchCase(const BenchCase_t* item, const BenchConfig_t* config,
+                 BenchResult_t* result) {
+  if (!item || !isValidBenchConfig(config) || !result) return 1;
+
+  // Выборки и их отклонения от медианы.
+  double* samples = malloc(2 * (size_t)config->repetitions * sizeof(double));
+  void* state = item->setup ? item->setup() : NULL;
+  if (!samples || (item->setup && !state)) {
+    free(samples);
+    if (item->teardown && state) item->teardown(state);
+    return 1;
+  }
+
+  unsigned long iterations = 1;
+  benchFailed = false;
+  while (!benchFailed && iterations < BENCH_MAX_ITERATIONS &&
+         sampleSeconds(item, state, iterations) < config->sampleSeconds)
+    iterations *= 2;
+  for (int i = 0; !benchFailed && i < config->warmup; i++)
+    sampleSeconds(item, state, iterations);
+  for (int i = 0; !benchFailed && i < config->repetitions; i++)
+    samples[i] =
+        sampleSeconds(item, state, iterations) * 1e9 / (double)iterations;
+  if (benchFailed) {
+    if (item->teardown) item->teardown(state);
+    free(samples);
+    return 1;
+  }
+
+  result->name = item->name;
+  result->iterations = iterations;
+  result->repetitions = config->repetitions;
+  summarize(samples, config->repetitions, result);
+
+  if (item->teardown) item->teardown(state);
+  free(samples);
+
+  return 0;
+}
+
+void printBenchResult(FILE* stream, const BenchResult_t* result) {
+  fprintf(stream, "%-24s %12.1f ns/op  mad %8.1f  min %10.1f  x%lu\n",
+          result->name, result->median, result->mad, result->min,
+          result->iterations);
+}
+
+static void writeJsonString(FILE* stream, const char* string) {
+  fputc('"', stream);
+  for (; *string; string++) {
+    if (*string == '"' || *string == '\\') fputc('\\', stream);
+    if ((unsigned char)*string >= 0x20) fputc(*string, stream);
+  }
+  fputc('"', stream);
+}
+
+int writeBenchJson(FILE* stream, const char* game, const BenchConfig_t* config,
+                   const BenchResult_t* results, int count) {
+  char timestamp[32] = "";
+  time_t now = time(NULL);
+  struct tm utc;
+
+  if (gmtime_r(&now, &utc))
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+
+  fprintf(stream, "{\n  \"suite\": \"brick_game\",\n  \"version\": ");
+  writeJsonString(stream, BENCH_VERSION);
+  fprintf(stream, ",\n  \"game\": ");
+  writeJsonString(stream, game);
+  fprintf(stream, ",\n  \"timestamp\": ");
+  writeJsonString(stream, timestamp);
+  fprintf(stream,
+          ",\n  \"unit\": \"ns/op\",\n  \"warmup\": %d,\n"
+          "  \"repetitions\": %d,\n  \"sample_ms\": %g,\n  \"results\": [",
+          config->warmup, config->repetitions, config->sampleSeconds * 1e3);
+  for (int i = 0; i < count; i++) {
+    fprintf(stream, "%s\n    {\"name\": ", i ? "," : "");
+    writeJsonString(stream, results[i].name);
+    fprintf(stream,
+            ", \"iterations\": %lu, \"median\": %.3f, \"mad\": %.3f, "
+            "\"min\": %.3f, \"max\": %.3f}",
+            results[i].iterations, results[i].median, results[i].mad,
+            results[i].min, results[i].max);
+  }
+  fprintf(stream, "\n  ]\n}\n");
+
+  return ferror(stream) ? 1 : 0;
+}
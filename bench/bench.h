@@ -0,0 +1,182 @@
+/**
+ * @file bench.h
+ * @brief Микробенчмарки BrickGame
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль измеряет длительность одной операции (ns/op)
+ * отдельных функций модели и представления. Замер случая (BenchCase_t)
+ * состоит из выборок, каждая выборка — серия из `iterations` операций:
+ *          - количество операций в выборке подбирается удвоением, пока
+ *            выборка не займет не меньше BenchConfig_t::sampleSeconds;
+ *          - первые `warmup` выборок (прогрев кэшей и предсказателя
+ *            переходов) отбрасываются;
+ *          - по остальным `repetitions` выборкам вычисляются медиана и
+ *            медианное абсолютное отклонение (MAD), устойчивые к редким
+ *            выбросам (вытеснение потока, прерывания).
+ *
+ * Результаты выводятся таблицей и записываются в формате JSON
+ * (writeBenchJson()) для сравнения версий.
+ *
+ * Набор случаев не зависит от игры, кроме случаев конкретной игры
+ * (cases.h): игра определяется библиотекой модели (tetris.a, snake.a), с
+ * которой собирается набор.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+/**
+ * @def BENCH_VERSION
+ * @brief Версия проекта в отчете JSON (задается при сборке)
+ */
+#ifndef BENCH_VERSION
+#define BENCH_VERSION "2.0"
+#endif
+
+/**
+ * @def BENCH_WARMUP
+ * @brief Количество отбрасываемых выборок по умолчанию
+ */
+#define BENCH_WARMUP 3
+
+/**
+ * @def BENCH_REPETITIONS
+ * @brief Количество учитываемых выборок по умолчанию
+ */
+#define BENCH_REPETITIONS 15
+
+/**
+ * @def BENCH_MAX_REPETITIONS
+ * @brief Наибольшее количество учитываемых выборок
+ */
+#define BENCH_MAX_REPETITIONS 1000
+
+/**
+ * @def BENCH_SAMPLE_MS
+ * @brief Наименьшая длительность выборки по умолчанию, мс
+ */
+#define BENCH_SAMPLE_MS 10
+
+/**
+ * @def BENCH_MAX_ITERATIONS
+ * @brief Наибольшее количество операций в выборке
+ */
+#define BENCH_MAX_ITERATIONS (1ul << 30)
+
+/**
+ * @struct BenchCase_t
+ * @brief Случай замера.
+ * @details Функция `setup` создает состояние случая (NULL — ошибка),
+ * `run` выполняет `iterations` операций над ним, `teardown` уничтожает его.
+ * Результат операций сохраняется в состоянии или в benchSink, чтобы
+ * компилятор не удалил вычисления. Ошибку операции (например, исчерпание
+ * памяти) `run` отмечает флагом benchFailed: результат такого случая не
+ * выводится.
+ */
+typedef struct BenchCase_t {
+  const char* name;                                ///< Имя случая
+  void* (*setup)(void);                            ///< Создание состояния
+  void (*run)(void* state, unsigned long iterations);  ///< Серия операций
+  void (*teardown)(void* state);                   ///< Уничтожение состояния
+} BenchCase_t;
+
+/**
+ * @struct BenchConfig_t
+ * @brief Параметры замера.
+ */
+typedef struct BenchConfig_t {
+  int warmup;            ///< Отбрасываемые выборки
+  int repetitions;       ///< Учитываемые выборки (1..BENCH_MAX_REPETITIONS)
+  double sampleSeconds;  ///< Наименьшая длительность выборки, с
+  const char* filter;    ///< Подстрока имени случая (NULL — все случаи)
+} BenchConfig_t;
+
+/**
+ * @struct BenchResult_t
+ * @brief Результат замера случая, ns/op.
+ */
+typedef struct BenchResult_t {
+  const char* name;          ///< Имя случая
+  unsigned long iterations;  ///< Операций в выборке
+  int repetitions;           ///< Учитываемые выборки
+  double median;             ///< Медиана
+  double mad;                ///< Медианное абсолютное отклонение
+  double min;                ///< Наименьшая выборка
+  double max;                ///< Наибольшая выборка
+} BenchResult_t;
+
+/**
+ * @brief Приемник результатов операций (защита от удаления вычислений).
+ */
+extern volatile unsigned long benchSink;
+
+/**
+ * @brief Признак ошибки операции случая, устанавливается функцией `run`.
+ */
+extern bool benchFailed;
+
+/**
+ * @defgroup BenchRoutines Функции микробенчмарков
+ * @brief Функции замера случаев и вывода результатов
+ */
+
+/**
+ * @ingroup BenchRoutines
+ * @brief Заполняет параметры замера значениями по умолчанию.
+ */
+void initBenchConfig(BenchConfig_t* config);
+
+/**
+ * @ingroup BenchRoutines
+ * @brief Проверяет параметры замера.
+ */
+bool isValidBenchConfig(const BenchConfig_t* config);
+
+/**
+ * @ingroup BenchRoutines
+ * @brief Проверяет, выбран ли случай фильтром параметров.
+ */
+bool isBenchCaseSelected(const BenchConfig_t* config, const BenchCase_t* item);
+
+/**
+ * @ingroup BenchRoutines
+ * @brief Выполняет замер случая.
+ * @return 0 в случае успеха, 1 при ошибке создания состояния, выделения
+ * памяти или операции случая (benchFailed).
+ */
+int runBenchCase(const BenchCase_t* item, const BenchConfig_t* config,
+                 BenchResult_t* result);
+
+/**
+ * @ingroup BenchRoutines
+ * @brief Выводит строку таблицы результатов.
+ */
+void printBenchResult(FILE* stream, const BenchResult_t* result);
+
+/**
+ * @ingroup BenchRoutines
+ * @brief Записывает результаты в формате JSON.
+ * @param game Имя игры библиотеки модели.
+ * @return 0 в случае успеха, 1 при ошибке записи.
+ * @details Пример отчета:
+ * @code
+ * {
+ *   "suite": "brick_game", "version": "2.0", "game": "tetris",
+ *   "timestamp": "2026-10-17T12:00:00Z", "unit": "ns/op",
+ *   "warmup": 3, "repetitions": 15, "sample_ms": 10,
+ *   "results": [
+ *     {"name": "matrix_create_remove", "iterations": 65536,
+ *      "median": 152.3, "mad": 1.2, "min": 150.8, "max": 160.1}
+ *   ]
+ * }
+ * @endcode
+ */
+int writeBenchJson(FILE* stream, const char* game, const BenchConfig_t* config,
+                   const BenchResult_t* results, int count);
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file cases.h
+ * @brief Случаи микробенчмарков BrickGame
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Случаи разделены на группы:
+ *          - модель (model_cases.c): создание и удаление матрицы
+ *            (createMatrix()/removeMatrix()), обработка триггера и такт FSM
+ *            (fsm_processTrigger(), fsm_update()), удаление заполненных
+ *            строк поля, такт игры в контексте со случайным вводом;
+ *          - представление (render_cases.c): формирование кадра
+ *            представления ANSI в памяти (initAnsiView(-1)) и вывод того же
+ *            кадра представлением ncurses в /dev/null — только
+ *            изменившиеся клетки и полный кадр;
+ *          - игра (games/tetris.c, games/snake.c): появление и поворот
+ *            фигуры, проверка столкновений для Tetris и шаг змейки для
+ *            Snake.
+ *
+ * Набор собирается с одним файлом группы игры, соответствующим библиотеке
+ * модели.
+ */
+
+#ifndef BENCH_CASES_H
+#define BENCH_CASES_H
+
+#include "bench.h"
+
+/**
+ * @def BENCH_SEED
+ * @brief Начальное значение генераторов случаев (замер воспроизводим)
+ */
+#define BENCH_SEED 1
+
+/**
+ * @brief Имя игры библиотеки модели ("tetris", "snake").
+ */
+extern const char* const benchGameName;
+
+/**
+ * @brief Возвращает случаи модели.
+ * @param count Количество случаев.
+ */
+const BenchCase_t* getModelBenchCases(int* count);
+
+/**
+ * @brief Возвращает случаи представления.
+ * @param count Количество случаев.
+ */
+const BenchCase_t* getRenderBenchCases(int* count);
+
+/**
+ * @brief Возвращает случаи игры библиотеки модели.
+ * @param count Количество случаев.
+ */
+const BenchCase_t* getGameBenchCases(int* count);
+
+#endif
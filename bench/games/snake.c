@@ -0,0 +1,99 @@
+/**
+ * @file snake.c
+ * @brief Случаи микробенчмарков игры Snake.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include <stdlib.h>
+
+#include "../../brick_game/common/game_context.h"
+#include "../../brick_game/common/game_rng.h"
+#include "../../brick_game/snake/snake.h"
+#include "../cases.h"
+
+/**
+ * @def BENCH_DIRECTIONS
+ * @brief Количество направлений движения змейки
+ */
+#define BENCH_DIRECTIONS 4
+
+const char* const benchGameName = "snake";
+
+/**
+ * @struct SnakeBench_t
+ * @brief Состояние случая snake_step.
+ */
+typedef struct SnakeBench_t {
+  GameContext_t* context;  ///< Экземпляр игры (арена и локаторы)
+  SnakeGame_t* game;       ///< Состояние игры контекста
+  GameRng_t rng;           ///< Генератор размещения еды
+} SnakeBench_t;
+
+static void* createSnakeBench(void) {
+  SnakeBench_t* bench = malloc(sizeof(SnakeBench_t));
+
+  if (bench && !(bench->context = createGameContext(BENCH_SEED))) {
+    free(bench);
+    return NULL;
+  }
+  if (bench) {
+    LocatorScope_t* previous = bindLocatorScope(&bench->context->scope);
+    bench->game = locateSnakeGame(NULL);
+    seedGameRng(&bench->rng, BENCH_SEED);
+    if (!bench->game ||
+        resetSnakeGame(bench->game, nextGameRng(&bench->rng))) {
+      bindLocatorScope(previous);
+      destroyGameContext(bench->context);
+      free(bench);
+      return NULL;
+    }
+    bindLocatorScope(previous);
+  }
+
+  return bench;
+}
+
+static void destroySnakeBench(void* state) {
+  SnakeBench_t* bench = state;
+
+  destroyGameContext(bench->context);
+  free(bench);
+}
+
+/*
+ * Змейка обходит поле вдоль стенок по часовой стрелке, поворачивая перед
+ * стенкой, и растет, пока не столкнется с собой; тогда игра начинается
+ * заново.
+ */
+static void runStep(void* state, unsigned long iterations) {
+  static const int dx[BENCH_DIRECTIONS] = {[ToRight] = 1, [ToLeft] = -1};
+  static const int dy[BENCH_DIRECTIONS] = {[ToTop] = -1, [ToBottom] = 1};
+  SnakeBench_t* bench = state;
+  SnakeGame_t* game = bench->game;
+  LocatorScope_t* previous = bindLocatorScope(&bench->context->scope);
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    const GameBlock_t* head = getGameBlock(game->body, 0);
+    int x = head->posX + dx[game->direction];
+    int y = head->posY + dy[game->direction];
+    if (x < 0 || x >= FIELD_WIDTH || y < 0 || y >= FIELD_HEIGHT)
+      turnSnake(game, (gameBlockOrientation)((game->direction + 1) %
+                                             BENCH_DIRECTIONS));
+
+    SnakeStepResult result = stepSnake(game, nextGameRng(&bench->rng));
+    if (result == SNAKE_COLLIDED || result == SNAKE_WON)
+      resetSnakeGame(game, nextGameRng(&bench->rng));
+    benchSink += (unsigned long)result;
+  }
+  bindLocatorScope(previous);
+}
+
+static const BenchCase_t gameCases[] = {
+    {"snake_step", createSnakeBench, runStep, destroySnakeBench}};
+
+const BenchCase_t* getGameBenchCases(int* count) {
+  *count = (int)(sizeof(gameCases) / sizeof(gameCases[0]));
+  return gameCases;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file tetris.c
+ * @brief Случаи микробенчмарков игры Tetris.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include <stdlib.h>
+
+#include "../../brick_game/common/game_rng.h"
+#include "../../brick_game/tetris/tetromino.h"
+#include "../cases.h"
+
+/**
+ * @def BENCH_COLUMNS
+ * @brief Количество проверяемых столбцов фигуры (с выходом за стенки)
+ */
+#define BENCH_COLUMNS (FIELD_WIDTH + 3)
+
+/**
+ * @def BENCH_ROWS
+ * @brief Количество проверяемых строк фигуры (с выходом за дно и верх)
+ */
+#define BENCH_ROWS (FIELD_HEIGHT + 3)
+
+const char* const benchGameName = "tetris";
+
+/**
+ * @brief Поле случаев: пустое (spawn_rotate) или с заполненной на две трети
+ * нижней половиной (collision).
+ */
+static void* createField(bool filled) {
+  GameField_t* field = malloc(sizeof(GameField_t));
+  GameRng_t rng;
+
+  if (!field || initGameField(field, FIELD_WIDTH, FIELD_HEIGHT)) {
+    free(field);
+    return NULL;
+  }
+
+  seedGameRng(&rng, BENCH_SEED);
+  for (int y = FIELD_HEIGHT / 2; filled && y < FIELD_HEIGHT; y++)
+    for (int x = 0; x < FIELD_WIDTH; x++)
+      if (nextGameRng(&rng) % 3) setFieldCell(field, x, y, 1);
+
+  return field;
+}
+
+static void* createEmptyField(void) { return createField(false); }
+
+static void* createFilledField(void) { return createField(true); }
+
+// Появление фигуры и полный оборот по часовой стрелке.
+static void runSpawnRotate(void* state, unsigned long iterations) {
+  const GameField_t* field = state;
+  GameBlock_t block;
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    spawnTetromino(&block, (int)(i % NUM_TETROMINOES));
+    for (int turn = 0; turn < NUM_ORIENTATIONS; turn++)
+      rotateTetromino(field, &block, ROTATE_CLOCKWISE);
+    benchSink += (unsigned long)block.posX;
+  }
+}
+
+/*
+ * Вид, ориентация и позиция фигуры перебираются с взаимно простыми
+ * периодами, поэтому проверяются и свободные, и занятые положения.
+ */
+static void runCollision(void* state, unsigned long iterations) {
+  const GameField_t* field = state;
+  unsigned long fits = 0;
+
+  for (unsigned long i = 0; i < iterations; i++)
+    fits += tetrominoFits(field, (int)(i % NUM_TETROMINOES),
+                          (gameBlockOrientation)(i % NUM_ORIENTATIONS),
+                          (int)(i % BENCH_COLUMNS) - 2,
+                          (int)(i % BENCH_ROWS) - 2);
+  benchSink += fits;
+}
+
+static const BenchCase_t gameCases[] = {
+    {"tetris_spawn_rotate", createEmptyField, runSpawnRotate, free},
+    {"tetris_collision", createFilledField, runCollision, free}};
+
+const BenchCase_t* getGameBenchCases(int* count) {
+  *count = (int)(sizeof(gameCases) / sizeof(gameCases[0]));
+  return gameCases;
+}
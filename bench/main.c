@@ -0,0 +1,124 @@
+/**
+ * @file main.c
+ * @brief Точка входа набора микробенчмарков BrickGame.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Использование:
+ * @code
+ * tetris_bench [--warmup N] [--repetitions N] [--sample-ms N]
+ *              [--filter NAME] [--json FILE]
+ * @endcode
+ * Таблица результатов выводится в стандартный поток вывода, отчет JSON
+ * (bench.h) записывается в FILE. С параметром `--filter` замеряются только
+ * случаи, имя которых содержит NAME.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "cases.h"
+
+/**
+ * @def BENCH_GROUPS
+ * @brief Количество групп случаев (модель, представление, игра)
+ */
+#define BENCH_GROUPS 3
+
+static void printUsage(const char* name) {
+  fprintf(stderr,
+          "Usage: %s [--warmup N] [--repetitions N] [--sample-ms N] "
+          "[--filter NAME] [--json FILE]\n",
+          name);
+}
+
+static int parseArguments(int argc, char** argv, BenchConfig_t* config,
+                          const char** json) {
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) return 1;
+
+    const char* value = argv[++i];
+    char* end = NULL;
+    unsigned long number = strtoul(value, &end, 10);
+    bool isNumber = *value != '\0' && *end == '\0';
+
+    if (!strcmp(argv[i - 1], "--json")) {
+      *json = value;
+    } else if (!strcmp(argv[i - 1], "--filter")) {
+      config->filter = value;
+    } else if (!isNumber) {
+      return 1;
+    } else if (!strcmp(argv[i - 1], "--warmup") && number <= 1000) {
+      config->warmup = (int)number;
+    } else if (!strcmp(argv[i - 1], "--repetitions") &&
+               number <= BENCH_MAX_REPETITIONS) {
+      config->repetitions = (int)number;
+    } else if (!strcmp(argv[i - 1], "--sample-ms") && number <= 60000) {
+      config->sampleSeconds = (double)number / 1e3;
+    } else {
+      return 1;
+    }
+  }
+
+  return !isValidBenchConfig(config);
+}
+
+static int writeJsonFile(const char* path, const BenchConfig_t* config,
+                         const BenchResult_t* results, int count) {
+  FILE* stream = fopen(path, "w");
+  if (!stream) return 1;
+
+  int error = writeBenchJson(stream, benchGameName, config, results, count);
+  if (fclose(stream)) error = 1;
+
+  return error;
+}
+
+int main(int argc, char** argv) {
+  BenchConfig_t config;
+  const char* json = NULL;
+
+  initBenchConfig(&config);
+  if (parseArguments(argc, argv, &config, &json)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const BenchCase_t* groups[BENCH_GROUPS];
+  int sizes[BENCH_GROUPS];
+  groups[0] = getModelBenchCases(&sizes[0]);
+  groups[1] = getRenderBenchCases(&sizes[1]);
+  groups[2] = getGameBenchCases(&sizes[2]);
+
+  int total = 0;
+  for (int i = 0; i < BENCH_GROUPS; i++) total += sizes[i];
+  BenchResult_t* results = malloc((size_t)total * sizeof(BenchResult_t));
+  if (!results) return EXIT_FAILURE;
+
+  int count = 0;
+  int error = 0;
+  printf("game: %s, warmup %d, repetitions %d, sample %g ms\n",
+         benchGameName, config.warmup, config.repetitions,
+         config.sampleSeconds * 1e3);
+  for (int i = 0; i < BENCH_GROUPS; i++) {
+    for (int j = 0; j < sizes[i]; j++) {
+      if (!isBenchCaseSelected(&config, &groups[i][j])) continue;
+      if (runBenchCase(&groups[i][j], &config, &results[count])) {
+        fprintf(stderr, "%s: failed\n", groups[i][j].name);
+        error = 1;
+        continue;
+      }
+      printBenchResult(stdout, &results[count++]);
+      fflush(stdout);
+    }
+  }
+
+  if (json && writeJsonFile(json, &config, results, count)) {
+    fprintf(stderr, "Can't write %s\n", json);
+    error = 1;
+  }
+  free(results);
+
+  return error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
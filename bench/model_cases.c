@@ -0,0 +1,218 @@
+/**
+ * @file model_cases.c
+ * @brief Случаи микробенчмарков модели, общие для всех игр.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include <stdlib.h>
+
+#include "../brick_game/common/fsm.h"
+#include "../brick_game/common/game_context.h"
+#include "../brick_game/common/game_rng.h"
+#include "cases.h"
+
+/**
+ * @def BENCH_FULL_ROWS
+ * @brief Количество заполненных строк поля в случае line_clear
+ */
+#define BENCH_FULL_ROWS 4
+
+/**
+ * @def BENCH_ACTION_RATE
+ * @brief Доля тактов с действием в случае game_tick (1 из BENCH_ACTION_RATE)
+ */
+#define BENCH_ACTION_RATE 5
+
+// Автомат из двух состояний, переключаемых одним триггером.
+enum { BENCH_STATE_A, BENCH_STATE_B, NUM_BENCH_STATES };
+enum { BENCH_TRIGGER_TOGGLE, NUM_BENCH_TRIGGERS };
+
+static void countUpdate(void* context) { ++*(unsigned long*)context; }
+
+static const Transition toStateB[] = {
+    {BENCH_TRIGGER_TOGGLE, BENCH_STATE_B, NULL}};
+static const Transition toStateA[] = {
+    {BENCH_TRIGGER_TOGGLE, BENCH_STATE_A, NULL}};
+static const FSMState benchStates[NUM_BENCH_STATES] = {
+    [BENCH_STATE_A] = {.id = BENCH_STATE_A,
+                       .onUpdate = countUpdate,
+                       FSM_TRANSITIONS(toStateB)},
+    [BENCH_STATE_B] = {.id = BENCH_STATE_B,
+                       .onUpdate = countUpdate,
+                       FSM_TRANSITIONS(toStateA)}};
+
+static const UserAction_t tickActions[] = {Left, Right, Up, Down, Action};
+
+/**
+ * @struct FsmBench_t
+ * @brief Состояние случаев fsm_process_trigger и fsm_update.
+ */
+typedef struct FsmBench_t {
+  FiniteStateMachine* fsm;  ///< Автомат из двух состояний
+  unsigned long updates;    ///< Счетчик вызовов onUpdate
+} FsmBench_t;
+
+/**
+ * @struct FieldBench_t
+ * @brief Состояние случая line_clear.
+ */
+typedef struct FieldBench_t {
+  GameField_t source;  ///< Исходное поле
+  GameField_t work;    ///< Копия поля для удаления строк
+} FieldBench_t;
+
+/**
+ * @struct TickBench_t
+ * @brief Состояние случая game_tick.
+ */
+typedef struct TickBench_t {
+  GameContext_t* context;  ///< Экземпляр игры
+  GameRng_t input;         ///< Генератор действий пользователя
+} TickBench_t;
+
+static void* createFsmBench(void) {
+  FsmBench_t* bench = calloc(1, sizeof(FsmBench_t));
+
+  if (bench && !(bench->fsm = fsm_create(benchStates, NUM_BENCH_STATES,
+                                         NUM_BENCH_TRIGGERS,
+                                         &bench->updates))) {
+    free(bench);
+    bench = NULL;
+  }
+
+  return bench;
+}
+
+static void destroyFsmBench(void* state) {
+  FsmBench_t* bench = state;
+
+  benchSink += bench->updates;
+  fsm_destroy(bench->fsm);
+  free(bench);
+}
+
+static void runProcessTrigger(void* state, unsigned long iterations) {
+  FsmBench_t* bench = state;
+
+  for (unsigned long i = 0; i < iterations; i++)
+    fsm_processTrigger(bench->fsm, BENCH_TRIGGER_TOGGLE);
+  benchSink += (unsigned long)bench->fsm->currentState;
+}
+
+static void runUpdate(void* state, unsigned long iterations) {
+  FsmBench_t* bench = state;
+
+  for (unsigned long i = 0; i < iterations; i++) fsm_update(bench->fsm);
+}
+
+static void* createContextBench(void) {
+  return createGameContext(BENCH_SEED);
+}
+
+static void destroyContextBench(void* state) { destroyGameContext(state); }
+
+// Матрица размещается в арене контекста; удаленная матрица возвращает
+// память арене, и следующая занимает тот же блок.
+static void runMatrix(void* state, unsigned long iterations) {
+  GameContext_t* context = state;
+  LocatorScope_t* previous = bindLocatorScope(&context->scope);
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    int** matrix = createMatrix(FIELD_HEIGHT, FIELD_WIDTH);
+    if (!matrix) {
+      benchFailed = true;
+      break;
+    }
+    matrix[0][0] = (int)i;
+    benchSink += (unsigned long)removeMatrix(FIELD_HEIGHT, FIELD_WIDTH, matrix);
+  }
+  bindLocatorScope(previous);
+}
+
+static void* createFieldBench(void) {
+  FieldBench_t* bench = malloc(sizeof(FieldBench_t));
+  GameRng_t rng;
+
+  if (!bench || initGameField(&bench->source, FIELD_WIDTH, FIELD_HEIGHT)) {
+    free(bench);
+    return NULL;
+  }
+
+  // Нижние строки заполнены, в остальных нижней половины есть пустая клетка.
+  seedGameRng(&rng, BENCH_SEED);
+  for (int y = FIELD_HEIGHT / 2; y < FIELD_HEIGHT; y++) {
+    int hole = y < FIELD_HEIGHT - BENCH_FULL_ROWS
+                   ? (int)(nextGameRng(&rng) % FIELD_WIDTH)
+                   : -1;
+    for (int x = 0; x < FIELD_WIDTH; x++)
+      if (x != hole) setFieldCell(&bench->source, x, y, 1 + x % 7);
+  }
+
+  return bench;
+}
+
+static void runLineClear(void* state, unsigned long iterations) {
+  FieldBench_t* bench = state;
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    bench->work = bench->source;
+    benchSink += (unsigned long)clearFullFieldRows(&bench->work);
+  }
+}
+
+static void* createTickBench(void) {
+  TickBench_t* bench = malloc(sizeof(TickBench_t));
+
+  if (bench && !(bench->context = createGameContext(BENCH_SEED))) {
+    free(bench);
+    return NULL;
+  }
+  if (bench) {
+    seedGameRng(&bench->input, BENCH_SEED);
+    contextUserInput(bench->context, Start, false);
+  }
+
+  return bench;
+}
+
+static void destroyTickBench(void* state) {
+  TickBench_t* bench = state;
+
+  destroyGameContext(bench->context);
+  free(bench);
+}
+
+// Такт со случайным действием, как в headless-симуляторе.
+static void runTick(void* state, unsigned long iterations) {
+  TickBench_t* bench = state;
+  GameContext_t* context = bench->context;
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    uint32_t random = nextGameRng(&bench->input);
+    if (random % BENCH_ACTION_RATE == 0)
+      contextUserInput(context,
+                       tickActions[random / BENCH_ACTION_RATE %
+                                   FSM_ARRAY_SIZE(tickActions)],
+                       false);
+    contextUpdate(context);
+    if (context->fsm->currentState == STATE_GAME_OVER)
+      contextUserInput(context, Start, false);
+  }
+  benchSink += (unsigned long)context->info->score;
+}
+
+static const BenchCase_t modelCases[] = {
+    {"matrix_create_remove", createContextBench, runMatrix,
+     destroyContextBench},
+    {"fsm_process_trigger", createFsmBench, runProcessTrigger,
+     destroyFsmBench},
+    {"fsm_update", createFsmBench, runUpdate, destroyFsmBench},
+    {"line_clear", createFieldBench, runLineClear, free},
+    {"game_tick", createTickBench, runTick, destroyTickBench}};
+
+const BenchCase_t* getModelBenchCases(int* count) {
+  *count = FSM_ARRAY_SIZE(modelCases);
+  return modelCases;
+}
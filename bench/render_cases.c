@@ -0,0 +1,233 @@
+/**
+ * @file render_cases.c
+ * @brief Случаи микробенчмарков представления.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Кадр формируется представлением ANSI без вывода на терминал
+ * (дескриптор -1): замеряется сравнение экранных буферов и формирование
+ * управляющих последовательностей, но не системный вызов write().
+ *
+ * Представление ncurses выводит тот же кадр для терминала BENCH_TERM в
+ * /dev/null: кроме формирования кадра замеряются системные вызовы write()
+ * ncurses, поэтому разница случаев render_ansi_* и render_ncurses_*
+ * ограничена сверху стоимостью вывода кадра ANSI.
+ */
+
+#include <stdlib.h>
+
+#include "../brick_game/common/game_field.h"
+#include "../brick_game/common/game_rng.h"
+#include "../gui/ansi/ansi_presenter.h"
+#include "../gui/cli/cli_presenter.h"
+#include "cases.h"
+
+/**
+ * @def BENCH_PANEL_LEFT
+ * @brief Столбец панели счета (как в раскладке контроллера)
+ */
+#define BENCH_PANEL_LEFT 25
+
+/**
+ * @def BENCH_PANEL_WIDTH
+ * @brief Ширина элементов панели счета
+ */
+#define BENCH_PANEL_WIDTH 8
+
+/**
+ * @def BENCH_FRAMES
+ * @brief Количество чередующихся кадров поля
+ */
+#define BENCH_FRAMES 2
+
+/**
+ * @def BENCH_NEXT_SIZE
+ * @brief Размер элемента следующей фигуры
+ */
+#define BENCH_NEXT_SIZE 4
+
+/**
+ * @def BENCH_TERM
+ * @brief Тип терминала представления ncurses (не зависит от окружения)
+ */
+#define BENCH_TERM "xterm"
+
+/**
+ * @struct RenderBench_t
+ * @brief Состояние случаев формирования кадра.
+ * @details Кадры поля отличаются положением падающей фигуры 2x2 (одна
+ * строка), как соседние кадры игры.
+ */
+typedef struct RenderBench_t {
+  AnsiView_t* view;  ///< Представление ANSI без вывода на терминал
+  ConsoleView_t* console;  ///< Представление ncurses (вывод в /dev/null)
+  FILE* output;            ///< Поток вывода представления ncurses
+  int field;         ///< Элемент поля
+  int next;          ///< Элемент следующей фигуры
+  int score;         ///< Элемент счета
+  int values[BENCH_FRAMES][FIELD_HEIGHT][FIELD_WIDTH];  ///< Клетки кадров
+  int* rows[BENCH_FRAMES][FIELD_HEIGHT];  ///< Матрицы кадров
+  int nextValues[BENCH_NEXT_SIZE][BENCH_NEXT_SIZE];  ///< Следующая фигура
+  int* nextRows[BENCH_NEXT_SIZE];  ///< Матрица следующей фигуры
+} RenderBench_t;
+
+static void fillFrames(RenderBench_t* bench) {
+  GameRng_t rng;
+
+  seedGameRng(&rng, BENCH_SEED);
+  for (int y = 0; y < FIELD_HEIGHT; y++) {
+    for (int x = 0; x < FIELD_WIDTH; x++) {
+      int value = y >= FIELD_HEIGHT / 2 && nextGameRng(&rng) % 3
+                      ? 1 + (int)(nextGameRng(&rng) % 7)
+                      : 0;
+      for (int frame = 0; frame < BENCH_FRAMES; frame++)
+        bench->values[frame][y][x] = value;
+    }
+  }
+  for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+    for (int y = frame + 1; y < frame + 3; y++)
+      for (int x = FIELD_WIDTH / 2 - 1; x <= FIELD_WIDTH / 2; x++)
+        bench->values[frame][y][x] = 2;
+    for (int y = 0; y < FIELD_HEIGHT; y++)
+      bench->rows[frame][y] = bench->values[frame][y];
+  }
+  for (int y = 0; y < BENCH_NEXT_SIZE; y++) {
+    for (int x = 0; x < BENCH_NEXT_SIZE; x++)
+      bench->nextValues[y][x] = y == 1 ? 1 : 0;
+    bench->nextRows[y] = bench->nextValues[y];
+  }
+}
+
+static void* createRenderBench(void) {
+  RenderBench_t* bench = malloc(sizeof(RenderBench_t));
+
+  if (bench && !(bench->view = initAnsiView(-1))) {
+    free(bench);
+    return NULL;
+  }
+  if (bench) {
+    fillFrames(bench);
+    bench->console = NULL;
+    bench->output = NULL;
+    bench->field = appendAnsiElement(bench->view, DATA_TYPE_INT2D, 0, 0,
+                                     FIELD_HEIGHT, FIELD_WIDTH, "FIELD");
+    bench->next = appendAnsiElement(bench->view, DATA_TYPE_INT2D, 0,
+                                    BENCH_PANEL_LEFT, BENCH_NEXT_SIZE,
+                                    BENCH_NEXT_SIZE, "NEXT");
+    bench->score = appendAnsiElement(bench->view, DATA_TYPE_INT, 6,
+                                     BENCH_PANEL_LEFT, 1, BENCH_PANEL_WIDTH,
+                                     "SCORE");
+  }
+
+  return bench;
+}
+
+static void* createConsoleBench(void) {
+  RenderBench_t* bench = malloc(sizeof(RenderBench_t));
+
+  if (bench && !(bench->output = fopen("/dev/null", "w"))) {
+    free(bench);
+    return NULL;
+  }
+  if (bench && !(bench->console = initViewStream(BENCH_TERM, bench->output))) {
+    fclose(bench->output);
+    free(bench);
+    return NULL;
+  }
+  if (bench) {
+    fillFrames(bench);
+    bench->view = NULL;
+    bench->field = appendViewElement(bench->console, DATA_TYPE_INT2D, 0, 0,
+                                     FIELD_HEIGHT, FIELD_WIDTH, "FIELD");
+    bench->next = appendViewElement(bench->console, DATA_TYPE_INT2D, 0,
+                                    BENCH_PANEL_LEFT, BENCH_NEXT_SIZE,
+                                    BENCH_NEXT_SIZE, "NEXT");
+    bench->score = appendViewElement(bench->console, DATA_TYPE_INT, 6,
+                                     BENCH_PANEL_LEFT, 1, BENCH_PANEL_WIDTH,
+                                     "SCORE");
+  }
+
+  return bench;
+}
+
+static void destroyRenderBench(void* state) {
+  RenderBench_t* bench = state;
+
+  if (bench->view) {
+    benchSink += getAnsiViewStats(bench->view)->bytes;
+    freeAnsiView(bench->view);
+  }
+  if (bench->console) {
+    freeView(bench->console);
+    fclose(bench->output);
+  }
+  free(bench);
+}
+
+static void renderFrames(RenderBench_t* bench, unsigned long iterations,
+                         bool full) {
+  for (unsigned long i = 0; i < iterations; i++) {
+    int score = (int)(i / BENCH_FRAMES);
+    refreshAnsiElement(bench->view, bench->field, DATA_TYPE_INT2D,
+                       bench->rows[i % BENCH_FRAMES]);
+    refreshAnsiElement(bench->view, bench->next, DATA_TYPE_INT2D,
+                       bench->nextRows);
+    refreshAnsiElement(bench->view, bench->score, DATA_TYPE_INT, &score);
+    if (full) invalidateAnsiView(bench->view);
+    renderAnsiView(bench->view);
+  }
+}
+
+/*
+ * Полный кадр ncurses: элементы выводятся заново (invalidateView()), а
+ * содержимое терминала объявляется неизвестным (clearok()), как в
+ * invalidateAnsiView().
+ */
+static void renderConsoleFrames(RenderBench_t* bench,
+                                unsigned long iterations, bool full) {
+  for (unsigned long i = 0; i < iterations; i++) {
+    int score = (int)(i / BENCH_FRAMES);
+    if (full) {
+      invalidateView(bench->console);
+      clearok(curscr, TRUE);
+    }
+    refreshViewElement(bench->console, bench->field, DATA_TYPE_INT2D,
+                       bench->rows[i % BENCH_FRAMES]);
+    refreshViewElement(bench->console, bench->next, DATA_TYPE_INT2D,
+                       bench->nextRows);
+    refreshViewElement(bench->console, bench->score, DATA_TYPE_INT, &score);
+    renderView(bench->console);
+  }
+}
+
+static void runDiffRender(void* state, unsigned long iterations) {
+  renderFrames(state, iterations, false);
+}
+
+static void runFullRender(void* state, unsigned long iterations) {
+  renderFrames(state, iterations, true);
+}
+
+static void runConsoleDiffRender(void* state, unsigned long iterations) {
+  renderConsoleFrames(state, iterations, false);
+}
+
+static void runConsoleFullRender(void* state, unsigned long iterations) {
+  renderConsoleFrames(state, iterations, true);
+}
+
+static const BenchCase_t renderCases[] = {
+    {"render_ansi_diff", createRenderBench, runDiffRender,
+     destroyRenderBench},
+    {"render_ansi_full", createRenderBench, runFullRender,
+     destroyRenderBench},
+    {"render_ncurses_diff", createConsoleBench, runConsoleDiffRender,
+     destroyRenderBench},
+    {"render_ncurses_full", createConsoleBench, runConsoleFullRender,
+     destroyRenderBench}};
+
+const BenchCase_t* getRenderBenchCases(int* count) {
+  *count = (int)(sizeof(renderCases) / sizeof(renderCases[0]));
+  return renderCases;
+}
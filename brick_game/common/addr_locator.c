@@ -0,0 +1,45 @@
+/**
+ * @file addr_locator.c
+ * @brief Реализация функций работы с локаторами ресурсов.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "addr_locator.h"
+
+#include <stddef.h>
+
+/**
+ * @brief Набор локаторов, привязанный к потоку.
+ * @details NULL — используются статические локаторы экземпляра по умолчанию.
+ */
+static _Thread_local LocatorScope_t* boundScope = NULL;
+
+LocatorScope_t* bindLocatorScope(LocatorScope_t* scope) {
+  LocatorScope_t* previous = boundScope;
+
+  boundScope = scope;
+  return previous;
+}
+
+AddressLocator_t* resolveLocator(AddressLocator_t* fallback,
+                                 LocatorSlot_t slot) {
+  return boundScope ? &boundScope->slots[slot] : fallback;
+}
+
+void* updateLocator(AddressLocator_t* locator, void* address) {
+  if (address == NULL) {
+    return locator->is_set ? locator->address : NULL;
+  }
+
+  if (!locator->is_set) {
+    locator->address = address;
+    locator->is_set = true;
+  } else if (address == locator->address) {
+    locator->address = NULL;
+    locator->is_set = false;
+  }
+
+  return locator->address;
+}
@@ -50,6 +50,67 @@ typedef struct {
   bool is_set;    ///< Флаг инициализации (true - адрес установлен)
 } AddressLocator_t;
 
+/**
+ * @enum LocatorSlot_t
+ * @ingroup AddressProviders
+ * @brief Перечисление ресурсов, адреса которых хранятся в локаторах.
+ */
+typedef enum {
+  LOCATOR_SESSION_ARENA,     ///< Арена сессии (SessionArena_t)
+  LOCATOR_GAME_INFO,         ///< Состояние игры (GameInfo_t)
+  LOCATOR_GAME_FIELD,        ///< Битовое поле (GameField_t)
+  LOCATOR_GAME_BLOCK_QUEUE,  ///< Очередь блоков (GameBlockQueue_t)
+  LOCATOR_GAME_RNG,          ///< Генератор случайных чисел (GameRng_t)
+  LOCATOR_FSM,               ///< Конечный автомат (FiniteStateMachine)
+  LOCATOR_GAME_MODEL,        ///< Собственные данные модели игры
+  LOCATOR_GAME_COUNTERS,     ///< Счетчики событий (GameCounters_t)
+  LOCATOR_INPUT_LOG,         ///< Запись ввода сессии (InputLog_t)
+  NUM_LOCATOR_SLOTS          ///< Количество ресурсов
+} LocatorSlot_t;
+
+/**
+ * @struct LocatorScope_t
+ * @ingroup AddressProviders
+ * @brief Набор локаторов одного экземпляра игры.
+ * @details Пока набор привязан к потоку (bindLocatorScope), функции-локаторы
+ * этого потока работают с локаторами набора вместо статических локаторов
+ * экземпляра по умолчанию. Так несколько экземпляров игры работают в одном
+ * процессе (в том числе в разных потоках) без общего изменяемого состояния.
+ */
+typedef struct LocatorScope_t {
+  AddressLocator_t slots[NUM_LOCATOR_SLOTS];  ///< Локаторы ресурсов
+} LocatorScope_t;
+
+/**
+ * @ingroup AddressProviders
+ * @brief Привязывает набор локаторов к текущему потоку.
+ * @param scope Набор локаторов или NULL (экземпляр по умолчанию).
+ * @return Ранее привязанный набор (для восстановления привязки).
+ */
+LocatorScope_t* bindLocatorScope(LocatorScope_t* scope);
+
+/**
+ * @ingroup AddressProviders
+ * @brief Возвращает локатор ресурса с учетом привязанного набора.
+ * @param fallback Статический локатор экземпляра по умолчанию.
+ * @param slot Ресурс.
+ * @return Локатор привязанного к потоку набора или `fallback`.
+ */
+AddressLocator_t* resolveLocator(AddressLocator_t* fallback,
+                                 LocatorSlot_t slot);
+
+/**
+ * @ingroup AddressProviders
+ * @brief Общая логика функций-локаторов.
+ * @param locator Локатор.
+ * @param address Адрес ресурса или NULL.
+ * @return Адрес, хранимый локатором после вызова.
+ * @details Если `address` равен NULL, возвращает хранимый адрес. Если локатор
+ * не установлен, сохраняет `address`. Если `address` совпадает с хранимым,
+ * сбрасывает локатор. Иначе локатор не изменяется.
+ */
+void* updateLocator(AddressLocator_t* locator, void* address);
+
 #ifdef __cplusplus
 }
 #endif
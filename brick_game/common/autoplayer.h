@@ -0,0 +1,66 @@
+/**
+ * @file autoplayer.h
+ * @brief Автоматический игрок BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль объявляет интерфейс автоматического игрока: игрок
+ * читает состояние модели через функции-локаторы, выбирает ход и передает
+ * его модели обычными действиями пользователя (userInput()). Поэтому ход
+ * игрока записывается в запись сессии (input_log.h) и воспроизводится без
+ * игрока, а модель не отличает игрока от человека.
+ *
+ * Интерфейс реализуется моделью конкретной игры (например,
+ * tetris/autoplayer.c). Функция autoplayMove() вызывается в каждом такте
+ * игрового цикла до обновления модели и должна вызываться в том же
+ * контексте игры (см. game_context.h), что и userInput().
+ */
+
+#ifndef AUTOPLAYER_H
+#define AUTOPLAYER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct Autoplayer_t
+ * @brief Состояние автоматического игрока (структура скрыта в реализации).
+ */
+typedef struct Autoplayer_t Autoplayer_t;
+
+/**
+ * @defgroup AutoplayerRoutines Функции автоматического игрока
+ * @brief Функции выбора и выполнения ходов
+ */
+
+/**
+ * @ingroup AutoplayerRoutines
+ * @brief Создает автоматического игрока.
+ * @param threads Количество потоков поиска хода (0 — по количеству ядер,
+ * 1 — поиск в вызывающем потоке).
+ * @return Указатель на игрока или NULL при ошибке создания (или если игра
+ * не поддерживает автоматического игрока).
+ */
+Autoplayer_t* createAutoplayer(int threads);
+
+/**
+ * @ingroup AutoplayerRoutines
+ * @brief Освобождает ресурсы игрока.
+ */
+void destroyAutoplayer(Autoplayer_t* player);
+
+/**
+ * @ingroup AutoplayerRoutines
+ * @brief Выбирает ход для текущего состояния игры и передает его модели.
+ * @return Количество переданных действий пользователя (0, если в текущем
+ * состоянии ход не нужен).
+ */
+int autoplayMove(Autoplayer_t* player);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -11,22 +11,33 @@
 
 #include "brick_game.h"
 
+#include <string.h>
+
 #include "addr_locator.h"
+#include "input_log.h"
+
+static size_t matrixSize(int rows, int cols) {
+  return sizeof(int *) * rows + sizeof(int) * rows * cols;
+}
 
 GameInfo_t *createGameInfo() {
+  SessionArena_t *arena = locateSessionArena(NULL);
   GameInfo_t *gameinfo = NULL;
 
-  if ((gameinfo = malloc(sizeof(GameInfo_t))) != NULL) {
-    if ((gameinfo->field = createMatrix(FIELD_HEIGHT, FIELD_WIDTH)) == NULL) {
-      free(gameinfo);
+  if ((gameinfo = arenaAlloc(arena, sizeof(GameInfo_t))) != NULL) {
+    gameinfo->field = createMatrix(FIELD_HEIGHT, FIELD_WIDTH);
+    gameinfo->next = createMatrix(MAX_GAMEBLOCK_SIZE, MAX_GAMEBLOCK_SIZE);
+    if (!gameinfo->field || !gameinfo->next) {
+      removeMatrix(FIELD_HEIGHT, FIELD_WIDTH, gameinfo->field);
+      removeMatrix(MAX_GAMEBLOCK_SIZE, MAX_GAMEBLOCK_SIZE, gameinfo->next);
+      arenaRelease(arena, gameinfo, sizeof(GameInfo_t));
       gameinfo = NULL;
     } else {
       gameinfo->high_score = 0;
-      gameinfo->level = 0;
+      gameinfo->level = 1;
       gameinfo->pause = 0;
       gameinfo->score = 0;
-      gameinfo->speed = 0;
-      gameinfo->next = NULL;
+      gameinfo->speed = 1;
       locateGameInfo(gameinfo);
     }
   }
@@ -36,39 +47,57 @@ GameInfo_t *createGameInfo() {
 
 void destroyGameInfo(GameInfo_t *gameinfo) {
   if (gameinfo) {
-    if (gameinfo->field) {
-      removeMatrix(FIELD_HEIGHT, FIELD_WIDTH, gameinfo->field);
-      gameinfo->field = NULL;
+    removeMatrix(FIELD_HEIGHT, FIELD_WIDTH, gameinfo->field);
+    gameinfo->field = NULL;
+    removeMatrix(MAX_GAMEBLOCK_SIZE, MAX_GAMEBLOCK_SIZE, gameinfo->next);
+    gameinfo->next = NULL;
+    if (gameinfo == locateGameInfo(NULL)) {
+      locateGameInfo(gameinfo);
     }
-    locateGameInfo(gameinfo);
-    free(gameinfo);
-    gameinfo = NULL;
+    arenaRelease(locateSessionArena(NULL), gameinfo, sizeof(GameInfo_t));
   }
 }
 
 GameInfo_t *locateGameInfo(GameInfo_t *gameinfo) {
   static AddressLocator_t locator = {NULL, false};
-  if (gameinfo == NULL) {
-    return locator.is_set ? (GameInfo_t *)locator.address : NULL;
+  AddressLocator_t *current = resolveLocator(&locator, LOCATOR_GAME_INFO);
+  return (GameInfo_t *)updateLocator(current, gameinfo);
+}
+
+GameField_t *createGameField() {
+  GameField_t *field = arenaAllocAligned(locateSessionArena(NULL),
+                                         sizeof(GameField_t), ARENA_CACHE_LINE);
+
+  if (field) {
+    initGameField(field, FIELD_WIDTH, FIELD_HEIGHT);
+    locateGameField(field);
   }
 
-  if (gameinfo == (GameInfo_t *)locator.address && locator.is_set) {
-    locator.address = NULL;
-    locator.is_set = false;
-  } else if (!locator.is_set) {
-    locator.address = (void *)gameinfo;
-    locator.is_set = true;
+  return field;
+}
+
+void destroyGameField(GameField_t *field) {
+  if (field) {
+    if (field == locateGameField(NULL)) {
+      locateGameField(field);
+    }
   }
+}
 
-  return (GameInfo_t *)locator.address;
+GameField_t *locateGameField(GameField_t *field) {
+  static AddressLocator_t locator = {NULL, false};
+  AddressLocator_t *current = resolveLocator(&locator, LOCATOR_GAME_FIELD);
+  return (GameField_t *)updateLocator(current, field);
 }
 
 int **createMatrix(int rows, int cols) {
   int **matrix = NULL;
-  int *values = NULL;
   if (rows > 0 && rows <= FIELD_HEIGHT && cols > 0 && cols <= FIELD_WIDTH) {
-    if ((matrix = (int **)malloc(sizeof(int *) * rows)) != NULL &&
-        (values = (int *)malloc(sizeof(int) * rows * cols)) != NULL) {
+    // Таблица указателей на строки и значения размещаются одним блоком.
+    if ((matrix = arenaAlloc(locateSessionArena(NULL),
+                             matrixSize(rows, cols))) != NULL) {
+      int *values = (int *)(matrix + rows);
+      memset(values, 0, sizeof(int) * rows * cols);
       for (int i = 0; i < rows; i++) {
         *(matrix + i) = values + (i * cols);
       }
@@ -80,35 +109,21 @@ int **createMatrix(int rows, int cols) {
 
 bool removeMatrix(int rows, int cols, int **matrix) {
   // Preprocessing of internal parameters
-  if (!matrix &&
-      (rows > 0 && rows <= FIELD_HEIGHT && cols > 0 && cols <= FIELD_WIDTH))
+  if (!matrix ||
+      !(rows > 0 && rows <= FIELD_HEIGHT && cols > 0 && cols <= FIELD_WIDTH))
     return false;
 
-  free(*matrix);
-  free(matrix);
+  arenaRelease(locateSessionArena(NULL), matrix, matrixSize(rows, cols));
   return true;
 }
 
-GameInfo_t updateCurrentState() {
-  GameInfo_t gameinfo = {0};
-
-  // gameinfo.field = updateMatrix();
-  // gameinfo.high_score = 0;
-  // gameinfo.score = updateScore();
-  // gameinfo.level = getCurrentLevel();
-  // gameinfo.next = getNextFigure();
-  // gameinfo.pause = getPauseState();
-  // gameinfo.speed = getGameSpeed();
-
-  return gameinfo;
-}
-
 int setGameBlockOrientation(GameBlock_t *gameblock,
                             gameBlockOrientation orientation) {
   int errval = -1;
 
-  if (gameblock) {
+  if (gameblock && orientation >= ToTop && orientation <= ToLeft) {
     gameblock->orientation = orientation;
+    errval = 0;
   }
 
   return errval;
@@ -124,102 +139,144 @@ int getGameBlockOrientation(GameBlock_t *gameblock) {
   }
 }
 
-GameBlockQueue_t *createGameBlockQueue() { 
-  GameBlockQueue_t* bQueue = NULL;
-  if ((bQueue = (GameBlockQueue_t*)malloc(sizeof(GameBlockQueue_t))) != NULL) {
-    bQueue->first = NULL;
-    bQueue->last = NULL;
+GameBlockQueue_t *createGameBlockQueue() {
+  SessionArena_t *arena = locateSessionArena(NULL);
+  GameBlockQueue_t *bQueue = NULL;
+  if ((bQueue = arenaAlloc(arena, sizeof(GameBlockQueue_t))) != NULL) {
+    bQueue->blocks =
+        arenaAlloc(arena, sizeof(GameBlock_t) * GAMEBLOCK_QUEUE_CAPACITY);
+    if (!bQueue->blocks) {
+      arenaRelease(arena, bQueue, sizeof(GameBlockQueue_t));
+      return NULL;
+    }
+    bQueue->capacity = GAMEBLOCK_QUEUE_CAPACITY;
+    bQueue->head = 0;
     bQueue->size = 0;
+    locateGameBlockQueue(bQueue);
   }
 
-  locateGameBlockQueue(bQueue);
-
-  return bQueue; 
+  return bQueue;
 }
 
-GameBlockQueue_t *locateGameBlockQueue(GameBlockQueue_t* blockQueue) {
+GameBlockQueue_t *locateGameBlockQueue(GameBlockQueue_t *blockQueue) {
   static AddressLocator_t locator = {NULL, false};
-  if (blockQueue == NULL) {
-    return locator.is_set ? (GameBlockQueue_t*)locator.address : NULL;
-  }
-
-  if (blockQueue == (GameBlockQueue_t*)locator.address && locator.is_set) {
-    locator.address = NULL;
-    locator.is_set = false;
-  } else if (!locator.is_set) {
-    locator.address = (void *)gameinfo;
-    locator.is_set = true;
-  }
-
-  return (GameBlockQueue_t*)locator->address;
+  AddressLocator_t *current =
+      resolveLocator(&locator, LOCATOR_GAME_BLOCK_QUEUE);
+  return (GameBlockQueue_t *)updateLocator(current, blockQueue);
 }
 
 void destroyGameBlockQueue(GameBlockQueue_t *blockQueue) {
   if (blockQueue) {
+    SessionArena_t *arena = locateSessionArena(NULL);
     if (blockQueue == locateGameBlockQueue(NULL)) {
       locateGameBlockQueue(blockQueue);
     }
 
-    populateGameBlockQueue(blockQueue);
-    free(blockQueue);
+    arenaRelease(arena, blockQueue->blocks,
+                 sizeof(GameBlock_t) * blockQueue->capacity);
+    arenaRelease(arena, blockQueue, sizeof(GameBlockQueue_t));
   }
 }
 
-int insertGameBlock(GameBlockQueue_t *blockQueue, GameBlock_t *gameBlock) {
-  if (!blockQueue || !gameBlock) return 1;
-  
-  if (blockQueue->size == 0) {
-    blockQueue->last = gameBlock;
-  } 
-  
-  if (blockQueue->first) {
-    gameBlock->nextBlock = blockQueue->first 
-  }
-  blockQueue->first = gameBlock;
-  return 0;
+static int queueIndex(const GameBlockQueue_t *blockQueue, int index) {
+  return (blockQueue->head + index) & (blockQueue->capacity - 1);
 }
 
-int populateGameBlockQueue(GameBlockQueue_t *blockQueue) { 
-  if (!blockQueue) return 1;
+static int growGameBlockQueue(GameBlockQueue_t *blockQueue) {
+  SessionArena_t *arena = locateSessionArena(NULL);
+  int capacity = blockQueue->capacity * 2;
+  GameBlock_t *blocks = arenaAlloc(arena, sizeof(GameBlock_t) * capacity);
+  if (!blocks) return 1;
 
-  while (blockQueue->size) {
-    GameBlock_t* block = blockQueue->first;
-    blockQueue->first = blockQueue->first->nextBlock;
-    --blockQueue->size;
-    if (block) deleteGameBlock(block);
+  for (int i = 0; i < blockQueue->size; i++) {
+    blocks[i] = blockQueue->blocks[queueIndex(blockQueue, i)];
   }
+  arenaRelease(arena, blockQueue->blocks,
+               sizeof(GameBlock_t) * blockQueue->capacity);
 
-  return 0; 
+  blockQueue->blocks = blocks;
+  blockQueue->capacity = capacity;
+  blockQueue->head = 0;
+  return 0;
 }
 
-GameBlock_t *createGameBlock(const int posX, const int posY, const int size, const gameBlockOrientation orientation, const int** blockMatrix) { 
-  GameBlock_t* block = NULL;
-  
-  if ((block = (GameBlock_t*)malloc(GameBlock_t)) != NULL) {
-    block->posX = posX;
-    block->posY = posY;
-    block->orientation = orientation;
-    block->field = blockMatrix;
-    block->nextBlock = NULL;
-  }
+int insertGameBlock(GameBlockQueue_t *blockQueue,
+                    const GameBlock_t *gameBlock) {
+  if (!blockQueue || !gameBlock) return 1;
+  if (blockQueue->size == blockQueue->capacity &&
+      growGameBlockQueue(blockQueue))
+    return 1;
 
-  return block; 
+  blockQueue->head = queueIndex(blockQueue, blockQueue->capacity - 1);
+  blockQueue->blocks[blockQueue->head] = *gameBlock;
+  ++blockQueue->size;
+  return 0;
 }
 
-void deleteGameBlock(GameBlock_t *gameBlock) {
+int pushBackGameBlock(GameBlockQueue_t *blockQueue,
+                      const GameBlock_t *gameBlock) {
+  if (!blockQueue || !gameBlock) return 1;
+  if (blockQueue->size == blockQueue->capacity &&
+      growGameBlockQueue(blockQueue))
+    return 1;
+
+  blockQueue->blocks[queueIndex(blockQueue, blockQueue->size)] = *gameBlock;
+  ++blockQueue->size;
+  return 0;
+}
+
+int popBackGameBlock(GameBlockQueue_t *blockQueue, GameBlock_t *gameBlock) {
+  if (!blockQueue || blockQueue->size == 0) return 1;
+
+  --blockQueue->size;
   if (gameBlock) {
-    if (gameBlock->field) {
-      if (*gameBlock->field) {
-        free(*gameBlock->field)
-      }
-      free(gameBlock->field);
-    }
-    free(gameBlock);
+    *gameBlock = blockQueue->blocks[queueIndex(blockQueue, blockQueue->size)];
   }
+  return 0;
+}
+
+GameBlock_t *getGameBlock(GameBlockQueue_t *blockQueue, int index) {
+  if (!blockQueue || index < 0 || index >= blockQueue->size) return NULL;
+
+  return &blockQueue->blocks[queueIndex(blockQueue, index)];
+}
+
+int populateGameBlockQueue(GameBlockQueue_t *blockQueue) {
+  if (!blockQueue) return 1;
+
+  blockQueue->head = 0;
+  blockQueue->size = 0;
+  return 0;
+}
+
+int initGameBlock(GameBlock_t *gameBlock, const int posX, const int posY,
+                  const int size, const gameBlockOrientation orientation,
+                  const int type) {
+  if (!gameBlock || size < MIN_GAMEBLOCK_SIZE || size > MAX_GAMEBLOCK_SIZE)
+    return 1;
+
+  gameBlock->posX = posX;
+  gameBlock->posY = posY;
+  gameBlock->size = size;
+  gameBlock->orientation = orientation;
+  gameBlock->type = type;
+  return 0;
+}
+
+GameCounters_t *getGameCounters() {
+  static GameCounters_t counters = {0, 0, 0};
+  static AddressLocator_t locator = {&counters, true};
+  return (GameCounters_t *)resolveLocator(&locator, LOCATOR_GAME_COUNTERS)
+      ->address;
 }
 
 void userInput(UserAction_t action, bool hold) {
-//TO-DO hold, обработка зажатия клавиши.
+  // Удержание повторяет только действия, выбранные моделью игры.
+  if (hold && !isRepeatableAction(action)) return;
+
+  InputLog_t *log = locateInputLog(NULL);
+  if (log) logUserAction(log, action, hold);
+
   switch (action) {
     case Start:
       fsm_processTrigger(locateFSM(NULL), TRIGGER_START_GAME);
@@ -242,8 +299,9 @@ void userInput(UserAction_t action, bool hold) {
     case Right:
       fsm_processTrigger(locateFSM(NULL), TRIGGER_MOVE_RIGHT);
       break;
-     case Action:
+    case Action:
       fsm_processTrigger(locateFSM(NULL), TRIGGER_ROTATE);
+      break;
     default:
       break;
   }
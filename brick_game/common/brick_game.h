@@ -13,25 +13,16 @@
 #include <stdlib.h>
 
 #include "fsm.h"
+#include "game_field.h"
+#include "game_rng.h"
+#include "session_arena.h"
 
 #ifndef BRICK_GAME_H
 #define BRICK_GAME_H
 
-/**
- * @def FIELD_HEIGHT
- * @brief Макрос, определяющий высоту игрового поля
- * @details Используется, для определения размерности матрицы игрового поля.
- * Высота поля задана значением 20.
- */
-#define FIELD_HEIGHT 20
-
-/**
- * @def FIELD_WIDTH
- * @brief Макрос, определяющий ширину игрового поля
- * @details Используется, для определения размерности матрицы игрового поля.
- * Ширина поля определена значением 10.
- */
-#define FIELD_WIDTH 10
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /**
  * @def MIN_GAMEBLOCK_SIZE
@@ -147,51 +138,66 @@ typedef struct GameInfo_t {
 
 } GameInfo_t;
 
-/**
- * @struct GameField_t
- * @brief Структура хранения состяния поля
- * @details Структура предназначена для хранения состояния поля.
- * 
- * @see GameInfo_t
- */
-typedef struct GameField_t {
-  int** filed; ///< Матрица поля
-  int width;   ///< Ширина поля
-  int height;  ///< Высота поля
-} GameInfo_t;
-
 /**
  * @struct GameBlock_t
  * @brief Структура описания игровых блоков
  * @details Структура предназначена для хранения сведений об игровом блоке
  * (Тетрамино или пиксель для игр Tetris и Snake соответственно).
- * 
+ * Форма блока не хранится в структуре: она определяется видом блока (`type`)
+ * и ориентацией по таблицам конкретной игры (например, tetromino.h).
+ *
  * @see gameBlockOrientation
  */
 typedef struct GameBlock_t {
-  int** field;  ///< Указатель на матрицу игровой структуры
+  int type;     ///< Вид блока (например, TetrominoType для Tetris)
   int size;     ///< Размер сторон матрицы (квадратная матрица)
   int posX;     ///< Координаты левого верхнего угла матрицы игрового блока по
                 ///< горизотали
   int posY;     ///< Координаты левого верхнего угла матрицы игрвого блока по
                 ///< вертикали
   gameBlockOrientation orientation;  ///< Ориентация игрового блока.
-  GameBlock_t* nextBlock; ///< Указатель на следующий блок, для организации очереди.
 } GameBlock_t;
 
 
+/**
+ * @def GAMEBLOCK_QUEUE_CAPACITY
+ * @brief Начальная емкость очереди игровых блоков
+ * @details Значение должно быть степенью двойки. При заполнении очереди ее
+ * емкость удваивается.
+ */
+#define GAMEBLOCK_QUEUE_CAPACITY 16
+
 /**
  * @struct GameBlockQueue_t
  * @brief Структура организации очереди игровых блоков.
  * @details Структура предназначена для организации очереди игровых блоков. Например для тетерис это текущая и следующая фигура.
  * Для Snake это цепочка одиночных фрагментов змейки.
+ *
+ * Очередь реализована кольцевым буфером записей GameBlock_t: вставка в начало
+ * (insertGameBlock) и удаление с конца (popBackGameBlock) выполняются за O(1)
+ * без обращения к распределителю памяти. Элемент с индексом 0 — первый
+ * (голова змейки, следующая фигура), элемент с индексом `size - 1` —
+ * последний.
  */
 typedef struct GameBlockQueue_t {
-  GameBlock_t* first;  ///< Ссылка на первый элемент списка
-  GameBlock_t* last;   ///< Ссылка на последний элемент списка
-  int size;            ///< Размер списка
+  GameBlock_t* blocks;  ///< Кольцевой буфер записей блоков
+  int capacity;         ///< Емкость буфера (степень двойки)
+  int head;             ///< Индекс первого элемента в буфере
+  int size;             ///< Количество элементов в очереди
 } GameBlockQueue_t;
 
+/**
+ * @struct GameCounters_t
+ * @brief Счетчики событий игрового процесса.
+ * @details Счетчики увеличиваются моделью игры и используются для измерения
+ * производительности модели (например, в режиме headless-симуляции).
+ */
+typedef struct GameCounters_t {
+  unsigned long pieces;  ///< Количество появившихся фигур (съеденной еды)
+  unsigned long lines;   ///< Количество удаленных строк
+  unsigned long games;   ///< Количество завершенных игр
+} GameCounters_t;
+
 /**
  * @defgroup Data_structure_management Функции управления структурами данных
  * @brief Функции создают и уничтожают структуры
@@ -206,6 +212,8 @@ typedef struct GameBlockQueue_t {
   * @details Функция предназначена для выделения области памяти для хранения
   * структуры GameInfo_t. Функция возвращает указатель на выделенную область
   * памяти. В случае ошибки выделения памяти функция возвращает NULL.
+  * Память (структура, матрицы поля и следующей фигуры) выделяется из арены
+  * текущей сессии (locateSessionArena).
 */
 GameInfo_t* createGameInfo();
 
@@ -226,13 +234,33 @@ void destroyGameInfo(GameInfo_t* gameinfo);
  * @brief Функция (конструктор) создания матрицы.
  * @param rows Количество строк в матрице.
  * @param cols Количество столбцов в матрице.
- * @return Указатель на матрицу.
- * @details Функция предназначена для освобождения области памяти выделенной для
- * хранения структуры GameInfo_t.
+ * @return Указатель на матрицу, заполненную нулями, или NULL в случае ошибки.
+ * @details Таблица указателей на строки и значения матрицы выделяются одним
+ * блоком из арены текущей сессии. Матрица возвращается в арену функцией
+ * removeMatrix() с теми же размерами.
 */
 int** createMatrix(int rows, int cols);
 bool removeMatrix(int rows, int cols, int** matrix);
 
+/**
+ * @ingroup Data_structure_management Функции управления структурами данных
+ * @brief Функция (конструктор) создания битового поля GameField_t.
+ * @return Указатель на очищенное поле размером FIELD_HEIGHT x FIELD_WIDTH или
+ * NULL в случае ошибки выделения памяти.
+ *
+ * @details Память выделяется с выравниванием по кэш-линии, поэтому маски
+ * занятости строк поля занимают одну кэш-линию. Адрес поля сохраняется в
+ * локаторе (locateGameField).
+ */
+GameField_t* createGameField();
+
+/**
+ * @ingroup Data_structure_management Функции управления структурами данных
+ * @brief Функция (деструктор) освобождения памяти битового поля GameField_t.
+ * @param field Указатель на структуру поля.
+ */
+void destroyGameField(GameField_t* field);
+
 /**
  * @defgroup AddressProviders Поставщики адресов
  * @brief Структуры и методы для хранения указателей на ресурсы
@@ -261,18 +289,77 @@ bool removeMatrix(int rows, int cols, int** matrix);
 */
 GameInfo_t* locateGameInfo(GameInfo_t* gameinfo);
 
+/**
+ * @ingroup AddressProviders
+ * @brief Функция локатор битового поля GameField_t.
+ * @param field Указатель на структуру поля. Если `NULL`, возвращает текущее
+ * поле.
+ * @return Указатель на текущее поле или `NULL`.
+ * @details Поведение аналогично locateGameInfo().
+ *
+ * @warning Не передавайте адрес вручную — используйте только
+ * `createGameField`/`destroyGameField`.
+ */
+GameField_t* locateGameField(GameField_t* field);
+
 /**
  * @brief Функция обновления текущего состояния игрового процесса
  * @return Возвращает вычесленное состяние игрового процесса на основе изменений
  * произошедших в модели.
+ *
+ * @details Матрица GameInfo_t::field заполняется из битового поля
+ * (GameField_t) в момент вызова функции. Функция реализуется моделью
+ * конкретной игры (например, tetris.c), так как отображение активных блоков
+ * зависит от игры.
  */
 GameInfo_t updateCurrentState();
 
+/**
+ * @brief Матрица состояний конечного автомата игры.
+ * @details Определяется моделью конкретной игры (tetris.c, snake.c).
+ * Используется при создании конечного автомата:
+ * @code
+ * fsm_create(gameStates, NUM_STATES, NUM_TRIGGERS, gameInfo);
+ * @endcode
+ */
+extern const FSMState gameStates[NUM_STATES];
+
+/**
+ * @brief Функция (конструктор) создания собственных данных модели игры.
+ * @return 0 в случае успеха, 1 при ошибке.
+ * @details Вызывается после создания общих ресурсов сессии (арена, GameInfo_t,
+ * поле, очередь блоков) и до создания конечного автомата. Функция
+ * реализуется моделью конкретной игры.
+ */
+int createGameModel();
+
+/**
+ * @brief Функция (деструктор) собственных данных модели игры.
+ */
+void destroyGameModel();
+
+/**
+ * @brief Функция доступа к счетчикам событий игрового процесса.
+ * @return Указатель на счетчики текущего процесса.
+ */
+GameCounters_t* getGameCounters();
+
+/**
+ * @brief Признак действия, повторяемого при удержании клавиши.
+ * @details Определяется моделью конкретной игры: в Tetris повторяются
+ * перемещения Left, Right и Down (Up — мгновенное падение фигуры), в Snake —
+ * ускорение Action (повороты при удержании не меняются).
+ */
+bool isRepeatableAction(UserAction_t action);
+
 /**
  * @defgroup User_interaction_handlers Функции обработки действий пользователя
  * @brief Функции предназначенные для обработки действий пользователей
  * @param action Код действия пользователя (UserAction_t)
  * @param hold Признак удержания "зажатия" клавиши пользователем
+ * @details При удержании (hold = true) выполняются только действия,
+ * повторяемые моделью игры (isRepeatableAction()), с периодом автоповтора
+ * контроллера; остальные действия при удержании игнорируются.
  */
 void userInput(UserAction_t action, bool hold);
 
@@ -281,8 +368,11 @@ void userInput(UserAction_t action, bool hold);
  * @brief Функции предназначенные для изменения 
  */
 
-/** 
+/**
  * @brief Функция измениния ориентации блока на поле.
+ * @return 0 в случае успеха, -1 при ошибке параметров.
+ * @details Функция меняет только индекс ориентации. Проверку столкновений при
+ * повороте выполняет игра (например, rotateTetromino()).
  */
 int setGameBlockOrientation(GameBlock_t* gameblock,
   gameBlockOrientation orientation);
@@ -294,6 +384,7 @@ int getGameBlockOrientation(GameBlock_t* gameblock);
 
 /**
  * @brief Функция создания очереди блоков.
+ * @details Память выделяется из арены текущей сессии.
  */
 GameBlockQueue_t* createGameBlockQueue();
 
@@ -308,20 +399,52 @@ GameBlockQueue_t* locateGameBlockQueue(GameBlockQueue_t* blockQueue);
 void destroyGameBlockQueue(GameBlockQueue_t* blockQueue);
 
 /**
- * @brief Функция вставки игрового блока в очередь
+ * @brief Функция вставки игрового блока в начало очереди
+ * @return 0 в случае успеха, 1 при ошибке.
+ * @details Запись блока копируется в очередь. При заполнении буфера его
+ * емкость удваивается (память выделяется из арены текущей сессии).
  */
-int insertGameBlock(GameBlockQueue_t* blockQueue, GameBlock_t* gameBlock);
+int insertGameBlock(GameBlockQueue_t* blockQueue, const GameBlock_t* gameBlock);
+
+/**
+ * @brief Функция вставки игрового блока в конец очереди
+ * @return 0 в случае успеха, 1 при ошибке.
+ */
+int pushBackGameBlock(GameBlockQueue_t* blockQueue,
+                      const GameBlock_t* gameBlock);
+
+/**
+ * @brief Функция удаления игрового блока из конца очереди
+ * @param gameBlock Указатель для копии удаленной записи (может быть NULL).
+ * @return 0 в случае успеха, 1 если очередь пуста.
+ */
+int popBackGameBlock(GameBlockQueue_t* blockQueue, GameBlock_t* gameBlock);
+
+/**
+ * @brief Функция получения игрового блока по индексу
+ * @param index Индекс блока (0 — первый элемент очереди).
+ * @return Указатель на запись блока в очереди или NULL.
+ * @warning Указатель действителен до следующего изменения очереди.
+ */
+GameBlock_t* getGameBlock(GameBlockQueue_t* blockQueue, int index);
 
 /**
  * @brief Функция очистки очереди блоков.
+ * @details Очистка выполняется за O(1), буфер очереди сохраняется.
  */
 int populateGameBlockQueue(GameBlockQueue_t* blockQueue);
 
-//int popGameBlock(GameBlock_t* block);
-//int pushBackGameBlock(GameBlockQueue_t* blockQueue, GameBlock_t* gameBlock);
-//int popBackGameBlock(GameBlockQueue_t* blockQueue);
+/**
+ * @brief Функция инициализации записи игрового блока.
+ * @param type Вид блока (форма определяется видом и ориентацией).
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ */
+int initGameBlock(GameBlock_t* gameBlock, const int posX, const int posY,
+                  const int size, const gameBlockOrientation orientation,
+                  const int type);
 
-GameBlock_t *createGameBlock(const int posX, const int posY, const int size, const gameBlockOrientation orientation, const int** blockMatrix);
-void deleteGameBlock(GameBlock_t *gameBlock);
+#ifdef __cplusplus
+}
+#endif
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,236 @@
+/**
+ * @file field_simd.c
+ * @brief Реализация векторного удаления заполненных строк поля.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Векторные реализации собираются для x86 компилятором GCC (Clang)
+ * с атрибутом target, поэтому библиотека модели не требует флагов -msse2 и
+ * -mavx2, а реализация AVX2 вызывается только после проверки процессора
+ * (__builtin_cpu_supports). На других платформах используется скалярная
+ * реализация.
+ */
+
+#include "field_simd.h"
+
+#include <stdatomic.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FIELD_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @def FIELD_KERNEL_AUTO
+ * @brief Признак реализации, которая еще не выбрана
+ */
+#define FIELD_KERNEL_AUTO (-1)
+
+typedef int (*FindFullRows_t)(const FieldRow_t*, int, FieldRow_t, uint32_t*);
+
+static const char* kernelNames[NUM_FIELD_KERNELS] = {"scalar", "sse2",
+                                                     "avx2"};
+
+static _Atomic int activeKernel = FIELD_KERNEL_AUTO;
+
+static int countBits(uint32_t word) {
+  int count = 0;
+
+  for (; word; word &= word - 1) ++count;
+
+  return count;
+}
+
+static int countMaskBits(const uint32_t* mask, int count) {
+  int total = 0;
+
+  for (int i = 0; i < FIELD_MASK_WORDS(count); i++)
+    total += countBits(mask[i]);
+
+  return total;
+}
+
+static bool isMaskBitSet(const uint32_t* mask, int row) {
+  return (mask[row / FIELD_MASK_BITS] >> (row % FIELD_MASK_BITS)) & 1u;
+}
+
+static void findRowsScalar(const FieldRow_t* rows, int begin, int end,
+                           FieldRow_t full, uint32_t* mask) {
+  for (int i = begin; i < end; i++)
+    if (rows[i] == full)
+      mask[i / FIELD_MASK_BITS] |= 1u << (i % FIELD_MASK_BITS);
+}
+
+static int findFullRowsScalar(const FieldRow_t* rows, int count,
+                              FieldRow_t full, uint32_t* mask) {
+  memset(mask, 0, FIELD_MASK_WORDS(count) * sizeof(uint32_t));
+  findRowsScalar(rows, 0, count, full, mask);
+
+  return countMaskBits(mask, count);
+}
+
+#ifdef FIELD_SIMD_X86
+
+/*
+ * Результаты сравнения двух векторов по 8 строк упаковываются в байты
+ * (packs_epi16), поэтому movemask дает по одному биту на строку.
+ */
+__attribute__((target("sse2"))) static int findFullRowsSse2(
+    const FieldRow_t* rows, int count, FieldRow_t full, uint32_t* mask) {
+  const __m128i pattern = _mm_set1_epi16((short)full);
+  int i = 0;
+
+  memset(mask, 0, FIELD_MASK_WORDS(count) * sizeof(uint32_t));
+  for (; i + 16 <= count; i += 16) {
+    __m128i low = _mm_loadu_si128((const __m128i*)(rows + i));
+    __m128i high = _mm_loadu_si128((const __m128i*)(rows + i + 8));
+    __m128i packed = _mm_packs_epi16(_mm_cmpeq_epi16(low, pattern),
+                                     _mm_cmpeq_epi16(high, pattern));
+    uint32_t bits = (uint32_t)_mm_movemask_epi8(packed);
+    mask[i / FIELD_MASK_BITS] |= bits << (i % FIELD_MASK_BITS);
+  }
+  findRowsScalar(rows, i, count, full, mask);
+
+  return countMaskBits(mask, count);
+}
+
+/*
+ * packs_epi16 в AVX2 упаковывает 128-битные половины независимо, поэтому
+ * после упаковки 64-битные четверти переставляются в порядок строк.
+ */
+__attribute__((target("avx2"))) static int findFullRowsAvx2(
+    const FieldRow_t* rows, int count, FieldRow_t full, uint32_t* mask) {
+  const __m256i pattern = _mm256_set1_epi16((short)full);
+  int i = 0;
+
+  memset(mask, 0, FIELD_MASK_WORDS(count) * sizeof(uint32_t));
+  for (; i + FIELD_MASK_BITS <= count; i += FIELD_MASK_BITS) {
+    __m256i low = _mm256_loadu_si256((const __m256i*)(rows + i));
+    __m256i high = _mm256_loadu_si256((const __m256i*)(rows + i + 16));
+    __m256i packed = _mm256_packs_epi16(_mm256_cmpeq_epi16(low, pattern),
+                                        _mm256_cmpeq_epi16(high, pattern));
+    packed = _mm256_permute4x64_epi64(packed, 0xD8);
+    mask[i / FIELD_MASK_BITS] = (uint32_t)_mm256_movemask_epi8(packed);
+  }
+  findRowsScalar(rows, i, count, full, mask);
+
+  return countMaskBits(mask, count);
+}
+
+#endif
+
+static const FindFullRows_t kernels[NUM_FIELD_KERNELS] = {
+    findFullRowsScalar,
+#ifdef FIELD_SIMD_X86
+    findFullRowsSse2, findFullRowsAvx2
+#else
+    findFullRowsScalar, findFullRowsScalar
+#endif
+};
+
+bool isFieldKernelSupported(FieldKernel kernel) {
+  switch (kernel) {
+    case FIELD_KERNEL_SCALAR:
+      return true;
+#ifdef FIELD_SIMD_X86
+    case FIELD_KERNEL_SSE2:
+      return __builtin_cpu_supports("sse2");
+    case FIELD_KERNEL_AVX2:
+      return __builtin_cpu_supports("avx2");
+#endif
+    default:
+      return false;
+  }
+}
+
+int selectFieldKernel(FieldKernel kernel) {
+  if (!isFieldKernelSupported(kernel)) return 1;
+
+  atomic_store(&activeKernel, (int)kernel);
+
+  return 0;
+}
+
+FieldKernel getFieldKernel() {
+  int kernel = atomic_load(&activeKernel);
+
+  if (kernel == FIELD_KERNEL_AUTO) {
+    kernel = FIELD_KERNEL_SCALAR;
+    for (int i = NUM_FIELD_KERNELS - 1; i > FIELD_KERNEL_SCALAR; i--)
+      if (isFieldKernelSupported((FieldKernel)i)) {
+        kernel = i;
+        break;
+      }
+    atomic_store(&activeKernel, kernel);
+  }
+
+  return (FieldKernel)kernel;
+}
+
+const char* fieldKernelName(FieldKernel kernel) {
+  return kernel >= 0 && kernel < NUM_FIELD_KERNELS ? kernelNames[kernel]
+                                                   : "unknown";
+}
+
+int findFullRows(const FieldRow_t* rows, int count, FieldRow_t full,
+                 uint32_t* mask) {
+  if (!rows || !mask || count <= 0) return 0;
+
+  return kernels[getFieldKernel()](rows, count, full, mask);
+}
+
+static int compactRowsScalar(uint8_t* bytes, size_t rowSize, int count,
+                             const uint32_t* mask) {
+  int target = count - 1;
+
+  for (int row = count - 1; row >= 0; row--) {
+    if (isMaskBitSet(mask, row)) continue;
+    if (target != row)
+      memcpy(bytes + target * rowSize, bytes + row * rowSize, rowSize);
+    target--;
+  }
+
+  return target + 1;
+}
+
+/*
+ * Строки перебираются снизу вверх по словам маски: пустое слово — 32
+ * незаполненные строки подряд. Участок незаполненных строк между двумя
+ * заполненными переносится одним вызовом memmove.
+ */
+static int compactRowsRuns(uint8_t* bytes, size_t rowSize, int count,
+                           const uint32_t* mask) {
+  int target = count;  // Начало уплотненной части
+  int runEnd = count;  // Конец текущего участка (не включая)
+
+  for (int word = FIELD_MASK_WORDS(count) - 1; word >= 0; word--) {
+    uint32_t bits = mask[word];
+    for (int bit = FIELD_MASK_BITS - 1; bits; bit--) {
+      if (!((bits >> bit) & 1u)) continue;
+      bits &= ~(1u << bit);
+
+      int row = word * FIELD_MASK_BITS + bit;
+      int length = runEnd - row - 1;
+      target -= length;
+      if (length > 0 && target != row + 1)
+        memmove(bytes + target * rowSize, bytes + (row + 1) * rowSize,
+                (size_t)length * rowSize);
+      runEnd = row;
+    }
+  }
+  if (runEnd > 0 && target != runEnd)
+    memmove(bytes + (target - runEnd) * rowSize, bytes,
+            (size_t)runEnd * rowSize);
+
+  return target - runEnd;
+}
+
+int compactRows(void* rows, size_t rowSize, int count, const uint32_t* mask) {
+  if (!rows || !mask || !rowSize || count <= 0) return 0;
+
+  return getFieldKernel() == FIELD_KERNEL_SCALAR
+             ? compactRowsScalar(rows, rowSize, count, mask)
+             : compactRowsRuns(rows, rowSize, count, mask);
+}
@@ -0,0 +1,129 @@
+/**
+ * @file field_simd.h
+ * @brief Векторное удаление заполненных строк поля BrickGame
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует удаление заполненных строк битового поля
+ * (game_field.h) в два прохода:
+ *          - поиск заполненных строк (findFullRows()) — одно векторное
+ *            сравнение масок строк с маской заполненной строки на 16 (SSE2)
+ *            или 32 (AVX2) строки; результат — битовая маска номеров
+ *            заполненных строк;
+ *          - уплотнение (compactRows()) — незаполненные строки сдвигаются
+ *            вниз непрерывными участками между заполненными строками
+ *            (memmove), поэтому количество копирований равно количеству
+ *            участков, а не строк. Пустые слова маски пропускаются целиком.
+ *
+ * Если заполненных строк нет (обычный случай фиксации фигуры), поле только
+ * читается.
+ *
+ * Реализация выбирается при первом вызове по возможностям процессора
+ * (AVX2, затем SSE2, иначе скалярная) и может быть задана явно
+ * (selectFieldKernel()), например, для сравнения со скалярной реализацией.
+ * Все реализации дают побитово одинаковый результат.
+ *
+ * Функции не зависят от размеров GameField_t и принимают массивы строк
+ * произвольной длины.
+ */
+
+#ifndef FIELD_SIMD_H
+#define FIELD_SIMD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "game_field.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def FIELD_MASK_BITS
+ * @brief Количество строк в одном слове маски заполненных строк
+ */
+#define FIELD_MASK_BITS 32
+
+/**
+ * @def FIELD_MASK_WORDS
+ * @brief Количество слов маски заполненных строк для `rows` строк
+ */
+#define FIELD_MASK_WORDS(rows) \
+  (((rows) + FIELD_MASK_BITS - 1) / FIELD_MASK_BITS)
+
+/**
+ * @enum FieldKernel
+ * @brief Реализация поиска заполненных строк.
+ */
+typedef enum {
+  FIELD_KERNEL_SCALAR,  ///< Построчное сравнение (эталон)
+  FIELD_KERNEL_SSE2,    ///< 16 строк за итерацию (SSE2)
+  FIELD_KERNEL_AVX2,    ///< 32 строки за итерацию (AVX2)
+  NUM_FIELD_KERNELS     ///< Количество реализаций
+} FieldKernel;
+
+/**
+ * @defgroup FieldSimdRoutines Функции удаления заполненных строк
+ * @brief Функции поиска заполненных строк и уплотнения поля
+ */
+
+/**
+ * @ingroup FieldSimdRoutines
+ * @brief Проверяет, поддерживает ли процессор реализацию.
+ */
+bool isFieldKernelSupported(FieldKernel kernel);
+
+/**
+ * @ingroup FieldSimdRoutines
+ * @brief Задает реализацию поиска заполненных строк.
+ * @return 0 в случае успеха, 1 если реализация не поддерживается.
+ */
+int selectFieldKernel(FieldKernel kernel);
+
+/**
+ * @ingroup FieldSimdRoutines
+ * @brief Возвращает текущую реализацию поиска заполненных строк.
+ */
+FieldKernel getFieldKernel();
+
+/**
+ * @ingroup FieldSimdRoutines
+ * @brief Возвращает название реализации ("scalar", "sse2", "avx2").
+ */
+const char* fieldKernelName(FieldKernel kernel);
+
+/**
+ * @ingroup FieldSimdRoutines
+ * @brief Находит строки, равные маске `full`.
+ * @param rows Маски строк.
+ * @param count Количество строк.
+ * @param full Маска заполненной строки.
+ * @param mask Маска номеров строк из FIELD_MASK_WORDS(count) слов: бит
+ * `i % FIELD_MASK_BITS` слова `i / FIELD_MASK_BITS` установлен, если строка
+ * `i` заполнена.
+ * @return Количество заполненных строк.
+ */
+int findFullRows(const FieldRow_t* rows, int count, FieldRow_t full,
+                 uint32_t* mask);
+
+/**
+ * @ingroup FieldSimdRoutines
+ * @brief Удаляет отмеченные строки со сдвигом верхних строк вниз.
+ * @param rows Массив строк по `rowSize` байт (например, маски строк или
+ * строки плоскости цветов).
+ * @param rowSize Размер строки, байт.
+ * @param count Количество строк.
+ * @param mask Маска удаляемых строк (см. findFullRows()).
+ * @return Количество удаленных строк `n`. Содержимое первых `n` строк не
+ * определено и заполняется вызывающей стороной.
+ */
+int compactRows(void* rows, size_t rowSize, int count, const uint32_t* mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,18 +14,56 @@
 #include <stdlib.h>
 
 #include "addr_locator.h"
+#include "profiler.h"
 
-FiniteStateMachine* fsm_create(FSMState* states, int numStates, void* context) {
-  if (!states || numStates <= 0 || locateFSM(NULL)) {
+static bool compileDispatchTable(const FSMState* states, int numStates,
+                                 int numTriggers,
+                                 const Transition** dispatch) {
+  for (int i = 0; i < numStates * numTriggers; i++) {
+    dispatch[i] = NULL;
+  }
+
+  for (int i = 0; i < numStates; i++) {
+    const FSMState* state = &states[i];
+    if (state->id != i || state->numTransitions < 0 ||
+        (state->numTransitions > 0 && !state->transitions))
+      return false;
+
+    for (int j = 0; j < state->numTransitions; j++) {
+      const Transition* t = &state->transitions[j];
+      if (t->trigger < 0 || t->trigger >= numTriggers || t->targetState < 0 ||
+          t->targetState >= numStates)
+        return false;
+
+      const Transition** slot = &dispatch[i * numTriggers + t->trigger];
+      if (*slot) return false;  // Повторный переход по одному триггеру
+      *slot = t;
+    }
+  }
+
+  return true;
+}
+
+FiniteStateMachine* fsm_create(const FSMState* states, int numStates,
+                               int numTriggers, void* context) {
+  if (!states || numStates <= 0 || numTriggers <= 0) {
     return NULL;
   }
 
-  FiniteStateMachine* fsm = malloc(sizeof(FiniteStateMachine));
+  // Таблица переходов размещается в одном блоке памяти со структурой FSM.
+  size_t tableSize = sizeof(Transition*) * numStates * numTriggers;
+  FiniteStateMachine* fsm = malloc(sizeof(FiniteStateMachine) + tableSize);
   if (fsm) {
     fsm->states = states;
     fsm->numStates = numStates;
+    fsm->numTriggers = numTriggers;
+    fsm->dispatch = (const Transition**)(fsm + 1);
     fsm->currentState = 0;  // Начальное состояние
     fsm->context = context;
+    if (!compileDispatchTable(states, numStates, numTriggers, fsm->dispatch)) {
+      free(fsm);
+      return NULL;
+    }
     locateFSM(fsm);
   }
   return fsm;
@@ -33,19 +71,12 @@ FiniteStateMachine* fsm_create(FSMState* states, int numStates, void* context) {
 
 FiniteStateMachine* locateFSM(FiniteStateMachine* fsm) {
   static AddressLocator_t locator = {NULL, false};
-  if (fsm == NULL) {
-    return locator.is_set ? (FiniteStateMachine*)locator.address : NULL;
-  }
-
-  if (!locator.is_set) {
-    locator.address = (void*)fsm;
-    locator.is_set = true;
-  } else if (fsm == (FiniteStateMachine*)locator.address && locator.is_set) {
-    locator.address = NULL;
-    locator.is_set = false;
-  }
+  AddressLocator_t* current = resolveLocator(&locator, LOCATOR_FSM);
+  return (FiniteStateMachine*)updateLocator(current, fsm);
+}
 
-  return (FiniteStateMachine*)locator.address;
+void fsm_reset(FiniteStateMachine* fsm, int state) {
+  if (fsm && state >= 0 && state < fsm->numStates) fsm->currentState = state;
 }
 
 void fsm_destroy(FiniteStateMachine* fsm) {
@@ -58,21 +89,28 @@ void fsm_destroy(FiniteStateMachine* fsm) {
 }
 
 void fsm_processTrigger(FiniteStateMachine* fsm, int trigger) {
-  FSMState* current = &fsm->states[fsm->currentState];
-  for (int i = 0; i < current->numTransitions; i++) {
-    Transition* t = &current->transitions[i];
-    if (t->trigger == trigger) {
-      if (current->onExit) current->onExit(fsm->context);
-      fsm->currentState = t->targetState;
-      if (t->onEnter) t->onEnter(fsm->context);
-      break;
-    }
-  }
+  if (trigger < 0 || trigger >= fsm->numTriggers) return;
+
+  const Transition* t =
+      fsm->dispatch[fsm->currentState * fsm->numTriggers + trigger];
+  if (!t) return;
+
+  PROFILE_BEGIN(PROFILE_FSM_TRIGGER);
+  const FSMState* current = &fsm->states[fsm->currentState];
+  if (current->onExit) current->onExit(fsm->context);
+  if (t->onEnter) t->onEnter(fsm->context);
+  fsm->currentState = t->targetState;
+
+  const FSMState* target = &fsm->states[fsm->currentState];
+  if (target->onEnter) target->onEnter(fsm->context);
+  PROFILE_END(PROFILE_FSM_TRIGGER);
 }
 
 void fsm_update(FiniteStateMachine* fsm) {
-  FSMState* current = &fsm->states[fsm->currentState];
+  const FSMState* current = &fsm->states[fsm->currentState];
   if (current->onUpdate) {
+    PROFILE_BEGIN(PROFILE_FSM_UPDATE);
     current->onUpdate(fsm->context);
+    PROFILE_END(PROFILE_FSM_UPDATE);
   }
 }
\ No newline at end of file
@@ -21,6 +21,27 @@
 extern "C" {
 #endif
 
+/**
+ * @def FSM_ARRAY_SIZE
+ * @brief Количество элементов статического массива.
+ */
+#define FSM_ARRAY_SIZE(array) ((int)(sizeof(array) / sizeof((array)[0])))
+
+/**
+ * @def FSM_TRANSITIONS
+ * @brief Инициализатор списка переходов состояния FSMState.
+ * @details Размер списка вычисляется компилятором по массиву переходов, что
+ * исключает расхождение `numTransitions` с фактической длиной массива.
+ * @code
+ * static const Transition idleTransitions[] = {
+ *     {TRIGGER_START_GAME, STATE_START, NULL}};
+ * const FSMState states[] = {
+ *     [STATE_IDLE] = {.id = STATE_IDLE, FSM_TRANSITIONS(idleTransitions)}};
+ * @endcode
+ */
+#define FSM_TRANSITIONS(array) \
+  .transitions = (array), .numTransitions = FSM_ARRAY_SIZE(array)
+
 /**
  * @ingroup Callbacks
  * @brief Тип callback-функции, вызываемой при обработке состояния.
@@ -68,7 +89,7 @@ typedef struct FSMState {
   handlerCallback onUpdate;  ///< Callback при обновлении состояния (вызывается
                              ///< каждый цикл).
   handlerCallback onExit;  ///< Callback при выходе из состояния.
-  Transition* transitions;  ///< Массив переходов из этого состояния.
+  const Transition* transitions;  ///< Массив переходов из этого состояния.
   int numTransitions;  ///< Количество переходов в массиве.
 } FSMState;
 
@@ -80,8 +101,13 @@ typedef struct FSMState {
  * пользовательским контекстом.
  */
 typedef struct FiniteStateMachine {
-  FSMState* states;  ///< Массив всех возможных состояний. Не может быть `NULL`.
+  const FSMState* states;  ///< Массив всех возможных состояний. Не может быть
+                           ///< `NULL`.
   int numStates;  ///< Количество состояний в массиве. Должно быть > 0.
+  int numTriggers;  ///< Количество триггеров. Должно быть > 0.
+  const Transition** dispatch;  ///< Таблица переходов [состояние][триггер].
+                                ///< `NULL` — триггер в состоянии не
+                                ///< обрабатывается.
   int currentState;  ///< Индекс текущего состояния в массиве `states` (от 0 до
                      ///< `numStates-1`)
   void* context;  ///< Пользовательские данные, передаваемые в callback-функции.
@@ -102,17 +128,28 @@ typedef struct FiniteStateMachine {
  * @brief Создает новый экземпляр FSM.
  * @param states Массив состояний. Не может быть `NULL`.
  * @param numStates Количество состояний. Должно быть > 0.
+ * @param numTriggers Количество триггеров. Должно быть > 0.
  * @param context Пользовательские данные (могут быть `NULL`).
  * @return Указатель на созданный FSM. `NULL` в случае ошибки.
- * @warning Память для `states` должна быть выделена до вызова функции.
+ * @details При создании массив состояний компилируется в плотную таблицу
+ * переходов [состояние][триггер], поэтому обработка триггера сводится к одному
+ * индексированному чтению. Создание завершается ошибкой, если:
+ * - идентификатор состояния не совпадает с его индексом в массиве;
+ * - триггер или целевое состояние перехода вне допустимого диапазона;
+ * - в одном состоянии задано несколько переходов по одному триггеру.
+ * Адрес первого созданного FSM сохраняется в локаторе (locateFSM()); каждый
+ * экземпляр игры (LocatorScope_t) может иметь собственный FSM.
+ * @warning Память для `states` должна быть выделена до вызова функции и
+ * существовать все время работы FSM.
  * @code
  * FSMState states[] = {
  *     {STATE_IDLE, NULL, NULL, NULL, NULL, 0}
  * };
- * FiniteStateMachine* fsm = fsm_create(states, 1, gameInfo);
+ * FiniteStateMachine* fsm = fsm_create(states, 1, NUM_TRIGGERS, gameInfo);
  * @endcode
  */
-FiniteStateMachine* fsm_create(FSMState* states, int numStates, void* context);
+FiniteStateMachine* fsm_create(const FSMState* states, int numStates,
+                               int numTriggers, void* context);
 
 /**
  * @ingroup FSMMethods
@@ -123,6 +160,16 @@ FiniteStateMachine* fsm_create(FSMState* states, int numStates, void* context);
  */
 void fsm_destroy(FiniteStateMachine* fsm);
 
+/**
+ * @ingroup FSMMethods
+ * @brief Переводит FSM в заданное состояние без вызова callback-функций.
+ * @param fsm Указатель на FSM. Если `NULL`, функция ничего не делает.
+ * @param state Индекс состояния. Недопустимые значения игнорируются.
+ * @details Используется для повторного использования FSM (например, перед
+ * новой игрой в пакетной симуляции).
+ */
+void fsm_reset(FiniteStateMachine* fsm, int state);
+
 /**
  * @ingroup FSMMethods
  * @brief Обрабатывает триггер и выполняет переход между состояниями.
@@ -130,9 +177,13 @@ void fsm_destroy(FiniteStateMachine* fsm);
  * @param trigger Идентификатор триггера (например, `TRIGGER_PAUSE`).
  * @details Если триггер найден в текущем состоянии:
  * 1. Вызывается `onExit` текущего состояния.
- * 2. Обновляется текущее состояние.
- * 3. Вызывается `onEnter` нового состояния.
- * @warning Индекс `targetState` должен быть валидным.
+ * 2. Вызывается callback перехода (Transition::onEnter).
+ * 3. Обновляется текущее состояние.
+ * 4. Вызывается `onEnter` нового состояния.
+ *
+ * Триггеры вне диапазона и триггеры без перехода в текущем состоянии
+ * игнорируются. Callback-функции могут вызывать fsm_processTrigger()
+ * повторно: к моменту вызова `onEnter` текущее состояние уже обновлено.
  */
 void fsm_processTrigger(FiniteStateMachine* fsm, int trigger);
 
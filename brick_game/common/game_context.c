@@ -0,0 +1,101 @@
+/**
+ * @file game_context.c
+ * @brief Реализация контекста экземпляра игры.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Один контекст одновременно используется только одним потоком.
+ */
+
+#include "game_context.h"
+
+#include <stdlib.h>
+
+static bool createContextResources(GameContext_t* context, uint64_t seed) {
+  if ((context->arena = createSessionArena(SESSION_ARENA_SIZE)) == NULL ||
+      (context->info = createGameInfo()) == NULL ||
+      (context->field = createGameField()) == NULL ||
+      (context->blocks = createGameBlockQueue()) == NULL ||
+      (context->rng = createGameRng(seed)) == NULL || createGameModel())
+    return false;
+
+  context->fsm = fsm_create(gameStates, NUM_STATES, NUM_TRIGGERS,
+                            context->info);
+  return context->fsm != NULL;
+}
+
+static void destroyContextResources(GameContext_t* context) {
+  fsm_destroy(context->fsm);
+  destroyGameModel();
+  destroyGameRng(context->rng);
+  destroyGameBlockQueue(context->blocks);
+  destroyGameField(context->field);
+  destroyGameInfo(context->info);
+  destroySessionArena(context->arena);
+}
+
+GameContext_t* createGameContext(uint64_t seed) {
+  GameContext_t* context = calloc(1, sizeof(GameContext_t));
+
+  if (context) {
+    AddressLocator_t* counters = &context->scope.slots[LOCATOR_GAME_COUNTERS];
+    counters->address = &context->counters;
+    counters->is_set = true;
+
+    LocatorScope_t* previous = bindLocatorScope(&context->scope);
+    bool created = createContextResources(context, seed);
+    if (!created) destroyContextResources(context);
+    bindLocatorScope(previous);
+
+    if (!created) {
+      free(context);
+      context = NULL;
+    }
+  }
+
+  return context;
+}
+
+void destroyGameContext(GameContext_t* context) {
+  if (context) {
+    LocatorScope_t* previous = bindLocatorScope(&context->scope);
+    destroyContextResources(context);
+    bindLocatorScope(previous);
+    free(context);
+  }
+}
+
+void restartGameContext(GameContext_t* context, uint64_t seed) {
+  seedGameRng(context->rng, seed);
+  fsm_reset(context->fsm, STATE_IDLE);
+  context->info->pause = 0;
+}
+
+void contextUserInput(GameContext_t* context, UserAction_t action, bool hold) {
+  LocatorScope_t* previous = bindLocatorScope(&context->scope);
+  userInput(action, hold);
+  bindLocatorScope(previous);
+}
+
+void contextUpdate(GameContext_t* context) {
+  LocatorScope_t* previous = bindLocatorScope(&context->scope);
+  fsm_update(context->fsm);
+  bindLocatorScope(previous);
+}
+
+GameInfo_t contextCurrentState(GameContext_t* context) {
+  LocatorScope_t* previous = bindLocatorScope(&context->scope);
+  GameInfo_t info = updateCurrentState();
+  bindLocatorScope(previous);
+
+  return info;
+}
+
+int contextAutoplayMove(GameContext_t* context, Autoplayer_t* player) {
+  LocatorScope_t* previous = bindLocatorScope(&context->scope);
+  int actions = autoplayMove(player);
+  bindLocatorScope(previous);
+
+  return actions;
+}
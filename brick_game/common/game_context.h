@@ -0,0 +1,110 @@
+/**
+ * @file game_context.h
+ * @brief Контекст экземпляра игры BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует реентерабельный интерфейс модели: контекст
+ * (GameContext_t) владеет всеми ресурсами одного экземпляра игры (арена,
+ * GameInfo_t, поле, очередь блоков, генератор случайных чисел, данные модели,
+ * FSM) и собственным набором локаторов (LocatorScope_t). На время вызова
+ * функций context* набор локаторов контекста привязывается к текущему
+ * потоку, поэтому код модели, обращающийся к ресурсам через функции-локаторы,
+ * работает с ресурсами этого контекста.
+ *
+ * Функции-локаторы без привязанного контекста работают с экземпляром по
+ * умолчанию (ресурсы, созданные функциями create* напрямую, например
+ * контроллером).
+ *
+ * Разные контексты можно использовать одновременно в разных потоках: общего
+ * изменяемого состояния у них нет. Один контекст одновременно используется
+ * только одним потоком.
+ */
+
+#ifndef GAME_CONTEXT_H
+#define GAME_CONTEXT_H
+
+#include "addr_locator.h"
+#include "autoplayer.h"
+#include "brick_game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct GameContext_t
+ * @brief Структура ресурсов одного экземпляра игры.
+ */
+typedef struct GameContext_t {
+  LocatorScope_t scope;       ///< Локаторы ресурсов экземпляра
+  GameCounters_t counters;    ///< Счетчики событий экземпляра
+  SessionArena_t* arena;      ///< Арена памяти экземпляра
+  GameInfo_t* info;           ///< Состояние игры
+  GameField_t* field;         ///< Битовое поле
+  GameBlockQueue_t* blocks;   ///< Очередь блоков
+  GameRng_t* rng;             ///< Генератор случайных чисел модели
+  FiniteStateMachine* fsm;    ///< Конечный автомат игры
+} GameContext_t;
+
+/**
+ * @defgroup ContextRoutines Функции контекста экземпляра игры
+ * @brief Реентерабельный интерфейс модели
+ */
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Функция (конструктор) создания контекста экземпляра игры.
+ * @param seed Начальное значение генератора случайных чисел модели.
+ * @return Указатель на контекст или NULL при ошибке создания ресурсов.
+ * @details FSM контекста находится в состоянии STATE_IDLE.
+ */
+GameContext_t* createGameContext(uint64_t seed);
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Функция (деструктор) контекста экземпляра игры.
+ * @param context Указатель на контекст. Если `NULL`, функция ничего не делает.
+ */
+void destroyGameContext(GameContext_t* context);
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Возвращает контекст в начальное состояние (STATE_IDLE) и заново
+ * инициализирует генератор случайных чисел.
+ * @details Счетчики событий не сбрасываются.
+ */
+void restartGameContext(GameContext_t* context, uint64_t seed);
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Обрабатывает действие пользователя в контексте (см. userInput()).
+ */
+void contextUserInput(GameContext_t* context, UserAction_t action, bool hold);
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Выполняет один такт модели в контексте (fsm_update()).
+ */
+void contextUpdate(GameContext_t* context);
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Возвращает состояние игры контекста (см. updateCurrentState()).
+ */
+GameInfo_t contextCurrentState(GameContext_t* context);
+
+/**
+ * @ingroup ContextRoutines
+ * @brief Выполняет ход автоматического игрока в контексте (см.
+ * autoplayMove()).
+ * @return Количество переданных действий пользователя.
+ */
+int contextAutoplayMove(GameContext_t* context, Autoplayer_t* player);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
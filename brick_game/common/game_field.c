@@ -0,0 +1,157 @@
+/**
+ * @file game_field.c
+ * @brief Реализация битового представления игрового поля.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Все функции не потокобезопасны. Используйте в однопоточных
+ * приложениях.
+ */
+
+#include "game_field.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "field_simd.h"
+
+_Static_assert(FIELD_WIDTH + 2 * FIELD_WALL_OFFSET <= FIELD_ROW_BITS,
+               "Field row does not fit into FieldRow_t");
+
+static bool isInsideField(const GameField_t* field, int x, int y) {
+  return x >= 0 && x < field->width && y >= 0 && y < field->height;
+}
+
+FieldRow_t makeEmptyFieldRow(int width) {
+  uint32_t cells = ((1u << width) - 1u) << FIELD_WALL_OFFSET;
+  return (FieldRow_t)(FIELD_FULL_ROW & ~cells);
+}
+
+int initGameField(GameField_t* field, int width, int height) {
+  if (!field || width <= 0 || width > FIELD_WIDTH || height <= 0 ||
+      height > FIELD_HEIGHT)
+    return 1;
+
+  field->width = width;
+  field->height = height;
+  field->emptyRow = makeEmptyFieldRow(width);
+  clearGameField(field);
+
+  return 0;
+}
+
+void clearGameField(GameField_t* field) {
+  if (!field) return;
+
+  for (int i = 0; i < FIELD_HEIGHT; i++) {
+    field->rows[i] = field->emptyRow;
+  }
+  memset(field->colors, 0, sizeof(field->colors));
+}
+
+bool getFieldCell(const GameField_t* field, int x, int y) {
+  if (!field || !isInsideField(field, x, y)) return true;
+
+  return (field->rows[y] >> (x + FIELD_WALL_OFFSET)) & 1u;
+}
+
+int getFieldCellColor(const GameField_t* field, int x, int y) {
+  if (!field || !isInsideField(field, x, y)) return 0;
+
+  return field->colors[y][x];
+}
+
+void setFieldCell(GameField_t* field, int x, int y, int color) {
+  if (!field || !isInsideField(field, x, y)) return;
+
+  FieldRow_t bit = (FieldRow_t)(1u << (x + FIELD_WALL_OFFSET));
+  if (color) {
+    field->rows[y] |= bit;
+  } else {
+    field->rows[y] &= (FieldRow_t)~bit;
+  }
+  field->colors[y][x] = (uint8_t)color;
+}
+
+bool fieldCollides(const GameField_t* field, const FieldRow_t* shape,
+                   int shapeRows, int posX, int posY) {
+  if (!field || !shape) return true;
+
+  int shift = posX + FIELD_WALL_OFFSET;
+  for (int i = 0; i < shapeRows; i++) {
+    if (!shape[i]) continue;
+    if (shift < 0) return true;
+
+    uint32_t mask = (uint32_t)shape[i] << shift;
+    if (mask > FIELD_FULL_ROW) return true;
+
+    int row = posY + i;
+    if (row >= field->height) return true;
+    if (row < 0) {
+      if (mask & field->emptyRow) return true;
+    } else if (mask & field->rows[row]) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void placeFieldShape(GameField_t* field, const FieldRow_t* shape,
+                     int shapeRows, int posX, int posY, int color) {
+  if (!field || !shape) return;
+
+  for (int i = 0; i < shapeRows; i++) {
+    int row = posY + i;
+    if (row < 0 || row >= field->height) continue;
+
+    for (int j = 0; j < FIELD_ROW_BITS; j++) {
+      if (!((shape[i] >> j) & 1u) || !isInsideField(field, posX + j, row))
+        continue;
+      field->rows[row] |= (FieldRow_t)(1u << (posX + j + FIELD_WALL_OFFSET));
+      field->colors[row][posX + j] = (uint8_t)color;
+    }
+  }
+}
+
+bool isFieldRowFull(const GameField_t* field, int row) {
+  if (!field || row < 0 || row >= field->height) return false;
+
+  return field->rows[row] == FIELD_FULL_ROW;
+}
+
+int clearFullFieldRows(GameField_t* field) {
+  if (!field) return 0;
+
+  uint32_t mask[FIELD_MASK_WORDS(FIELD_HEIGHT)];
+  if (!findFullRows(field->rows, field->height, FIELD_FULL_ROW, mask))
+    return 0;
+
+  int cleared = compactRows(field->rows, sizeof(field->rows[0]),
+                            field->height, mask);
+  compactRows(field->colors, sizeof(field->colors[0]), field->height, mask);
+  for (int row = 0; row < cleared; row++) {
+    field->rows[row] = field->emptyRow;
+    memset(field->colors[row], 0, sizeof(field->colors[row]));
+  }
+
+  return cleared;
+}
+
+int fieldToMatrix(const GameField_t* field, int** matrix) {
+  if (!field || !matrix) return 1;
+
+  for (int i = 0; i < field->height; i++) {
+    FieldRow_t cells = (FieldRow_t)(field->rows[i] >> FIELD_WALL_OFFSET);
+    for (int j = 0; j < field->width; j++) {
+      if ((cells >> j) & 1u) {
+        matrix[i][j] = field->colors[i][j] ? field->colors[i][j] : 1;
+      } else {
+        matrix[i][j] = 0;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file game_field.h
+ * @brief Битовое представление игрового поля BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует игровое поле в виде битовой доски (bitboard):
+ * каждая строка поля хранится одной 16-битной маской занятости. Слева и справа
+ * от рабочей области строки расположены "стенки" из постоянно установленных
+ * бит, поэтому:
+ *          - проверка столкновения фигуры — сдвиг и побитовое И;
+ *          - проверка заполненности строки — сравнение с константой
+ *            FIELD_FULL_ROW;
+ *          - маски занятости всего поля 20x10 умещаются в одну кэш-линию.
+ *
+ * Цвета клеток хранятся в отдельной (необязательной) плоскости и не участвуют
+ * в проверках столкновений.
+ *
+ * @warning Матрица `int**` для представления (GameInfo_t::field) формируется
+ * по запросу функцией fieldToMatrix() и не является источником истины.
+ */
+
+#ifndef GAME_FIELD_H
+#define GAME_FIELD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def FIELD_HEIGHT
+ * @brief Макрос, определяющий высоту игрового поля
+ * @details Используется, для определения размерности матрицы игрового поля.
+ * Высота поля задана значением 20.
+ */
+#define FIELD_HEIGHT 20
+
+/**
+ * @def FIELD_WIDTH
+ * @brief Макрос, определяющий ширину игрового поля
+ * @details Используется, для определения размерности матрицы игрового поля.
+ * Ширина поля определена значением 10.
+ */
+#define FIELD_WIDTH 10
+
+/**
+ * @def FIELD_WALL_OFFSET
+ * @brief Количество бит "стенки" слева от рабочей области строки
+ * @details Столбец `x` игрового поля хранится в бите `x + FIELD_WALL_OFFSET`
+ * маски строки. Ширина стенки выбрана так, чтобы фигура в матрице 4x4 могла
+ * выступать за левый край поля без отрицательного сдвига.
+ */
+#define FIELD_WALL_OFFSET 3
+
+/**
+ * @def FIELD_ROW_BITS
+ * @brief Разрядность маски строки поля
+ */
+#define FIELD_ROW_BITS 16
+
+/**
+ * @def FIELD_FULL_ROW
+ * @brief Маска полностью заполненной строки (включая стенки)
+ */
+#define FIELD_FULL_ROW ((FieldRow_t)0xFFFFu)
+
+/**
+ * @brief Тип маски занятости одной строки поля
+ */
+typedef uint16_t FieldRow_t;
+
+/**
+ * @struct GameField_t
+ * @brief Структура хранения состояния поля
+ * @details Структура хранит маски занятости строк поля (bitboard) и плоскость
+ * цветов клеток. Маски строк расположены в начале структуры, поэтому при
+ * выделении памяти с выравниванием по кэш-линии (createGameField) они
+ * занимают одну кэш-линию.
+ *
+ * @see GameInfo_t
+ */
+typedef struct GameField_t {
+  FieldRow_t rows[FIELD_HEIGHT];  ///< Маски занятости строк
+  FieldRow_t emptyRow;  ///< Маска пустой строки (установлены только стенки)
+  int width;            ///< Ширина поля
+  int height;           ///< Высота поля
+  uint8_t colors[FIELD_HEIGHT][FIELD_WIDTH];  ///< Плоскость цветов клеток
+} GameField_t;
+
+/**
+ * @defgroup FieldRoutines Функции работы с игровым полем
+ * @brief Функции чтения и изменения битового представления поля
+ */
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Инициализирует поле заданного размера и очищает его.
+ * @param field Указатель на структуру поля.
+ * @param width Ширина поля (от 1 до FIELD_WIDTH).
+ * @param height Высота поля (от 1 до FIELD_HEIGHT).
+ * @return 0 в случае успеха, 1 при недопустимых параметрах.
+ */
+int initGameField(GameField_t* field, int width, int height);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Очищает все клетки поля (стенки сохраняются).
+ * @param field Указатель на структуру поля.
+ */
+void clearGameField(GameField_t* field);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Возвращает маску пустой строки для поля заданной ширины.
+ * @param width Ширина поля.
+ */
+FieldRow_t makeEmptyFieldRow(int width);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Проверяет занятость клетки поля.
+ * @return true, если клетка занята. Клетки за пределами поля считаются
+ * занятыми.
+ */
+bool getFieldCell(const GameField_t* field, int x, int y);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Возвращает цвет клетки (0 — клетка свободна или цвет не задан).
+ */
+int getFieldCellColor(const GameField_t* field, int x, int y);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Устанавливает или очищает клетку поля.
+ * @param color Цвет клетки. Значение 0 освобождает клетку.
+ */
+void setFieldCell(GameField_t* field, int x, int y, int color);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Проверяет столкновение фигуры с содержимым поля.
+ * @param field Указатель на структуру поля.
+ * @param shape Маски строк фигуры. Бит `c` маски соответствует столбцу
+ * `posX + c` поля.
+ * @param shapeRows Количество строк фигуры.
+ * @param posX Положение левого столбца фигуры на поле.
+ * @param posY Положение верхней строки фигуры на поле.
+ * @return true, если фигура пересекается с занятыми клетками, стенками или
+ * дном поля.
+ *
+ * @details Строки фигуры выше поля (`posY + i < 0`) считаются свободными, что
+ * позволяет появляться фигурам частично над полем.
+ */
+bool fieldCollides(const GameField_t* field, const FieldRow_t* shape,
+                   int shapeRows, int posX, int posY);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Фиксирует фигуру на поле.
+ * @param color Цвет, которым заполняются клетки фигуры.
+ * @details Клетки фигуры за пределами поля отбрасываются.
+ */
+void placeFieldShape(GameField_t* field, const FieldRow_t* shape,
+                     int shapeRows, int posX, int posY, int color);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Проверяет заполненность строки поля.
+ */
+bool isFieldRowFull(const GameField_t* field, int row);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Удаляет заполненные строки со сдвигом верхних строк вниз.
+ * @return Количество удаленных строк.
+ * @details Заполненные строки ищутся векторно (см. field_simd.h).
+ */
+int clearFullFieldRows(GameField_t* field);
+
+/**
+ * @ingroup FieldRoutines
+ * @brief Формирует матричное представление поля для вывода на экран.
+ * @param field Указатель на структуру поля.
+ * @param matrix Матрица размером не менее height x width.
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ *
+ * @details Занятая клетка получает значение своего цвета (или 1, если цвет не
+ * задан), свободная — 0.
+ */
+int fieldToMatrix(const GameField_t* field, int** matrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
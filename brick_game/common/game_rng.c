@@ -0,0 +1,67 @@
+/**
+ * @file game_rng.c
+ * @brief Реализация генератора псевдослучайных чисел.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "game_rng.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "addr_locator.h"
+#include "session_arena.h"
+
+void seedGameRng(GameRng_t* rng, uint64_t seed) {
+  if (!rng) return;
+
+  // Перемешивание splitmix64 исключает нулевое состояние xorshift.
+  uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  z ^= z >> 31;
+  rng->state = z ? z : 0x9E3779B97F4A7C15ull;
+}
+
+uint32_t nextGameRng(GameRng_t* rng) {
+  uint64_t x = rng->state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  rng->state = x;
+  return (uint32_t)((x * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+GameRng_t* createGameRng(uint64_t seed) {
+  GameRng_t* rng = arenaAlloc(locateSessionArena(NULL), sizeof(GameRng_t));
+
+  if (rng) {
+    seedGameRng(rng, seed);
+    locateGameRng(rng);
+  }
+
+  return rng;
+}
+
+void destroyGameRng(GameRng_t* rng) {
+  if (rng) {
+    if (rng == locateGameRng(NULL)) {
+      locateGameRng(rng);
+    }
+    arenaRelease(locateSessionArena(NULL), rng, sizeof(GameRng_t));
+  }
+}
+
+GameRng_t* locateGameRng(GameRng_t* rng) {
+  static AddressLocator_t locator = {NULL, false};
+  AddressLocator_t* current = resolveLocator(&locator, LOCATOR_GAME_RNG);
+  return (GameRng_t*)updateLocator(current, rng);
+}
+
+unsigned int gameRandom() {
+  GameRng_t* rng = locateGameRng(NULL);
+
+  return rng ? nextGameRng(rng) : (unsigned int)rand();
+}
@@ -0,0 +1,83 @@
+/**
+ * @file game_rng.h
+ * @brief Генератор псевдослучайных чисел BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует детерминированный генератор
+ * псевдослучайных чисел (xorshift64*) с явным начальным значением. Все
+ * случайные решения модели (выбор фигуры, размещение еды) выполняются через
+ * gameRandom(), поэтому игра с одним и тем же начальным значением и теми же
+ * действиями пользователя воспроизводится полностью.
+ */
+
+#ifndef GAME_RNG_H
+#define GAME_RNG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct GameRng_t
+ * @brief Состояние генератора псевдослучайных чисел.
+ */
+typedef struct GameRng_t {
+  uint64_t state;  ///< Текущее состояние генератора (не равно 0)
+} GameRng_t;
+
+/**
+ * @defgroup RngRoutines Функции генератора случайных чисел
+ * @brief Функции инициализации и получения псевдослучайных чисел
+ */
+
+/**
+ * @ingroup RngRoutines
+ * @brief Инициализирует генератор начальным значением.
+ * @details Любое начальное значение (включая 0) дает корректное состояние.
+ */
+void seedGameRng(GameRng_t* rng, uint64_t seed);
+
+/**
+ * @ingroup RngRoutines
+ * @brief Возвращает следующее 32-битное псевдослучайное число.
+ */
+uint32_t nextGameRng(GameRng_t* rng);
+
+/**
+ * @ingroup RngRoutines
+ * @brief Создает генератор в арене текущей сессии.
+ * @return Указатель на генератор или NULL при ошибке выделения памяти.
+ * @details Адрес сохраняется в локаторе (locateGameRng).
+ */
+GameRng_t* createGameRng(uint64_t seed);
+
+/**
+ * @ingroup RngRoutines
+ * @brief Уничтожает генератор.
+ */
+void destroyGameRng(GameRng_t* rng);
+
+/**
+ * @ingroup AddressProviders
+ * @brief Функция локатор генератора случайных чисел модели.
+ * @details Поведение аналогично locateGameInfo().
+ */
+GameRng_t* locateGameRng(GameRng_t* rng);
+
+/**
+ * @ingroup RngRoutines
+ * @brief Возвращает случайное число для решений модели.
+ * @details Используется генератор из локатора. Если генератор не создан,
+ * используется rand().
+ */
+unsigned int gameRandom();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,289 @@
+/**
+ * @file game_snapshot.c
+ * @brief Реализация снимка состояния игры.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "game_snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fsm.h"
+#include "game_rng.h"
+
+#define MAGIC_SIZE (sizeof(GAME_SNAPSHOT_MAGIC) - 1)
+#define TEMP_SUFFIX ".tmp"
+#define MAX_TIMER_DELAY (3600 * NSEC_PER_SEC)
+
+/**
+ * @struct SnapshotTimer_t
+ * @brief Таймер в снимке: время до срока отсчитывается от момента записи.
+ */
+typedef struct SnapshotTimer_t {
+  uint8_t active;     ///< Признак запущенного таймера
+  int64_t remaining;  ///< Время до срока, нс
+  int64_t interval;   ///< Период, нс
+} SnapshotTimer_t;
+
+/**
+ * @struct SnapshotState_t
+ * @brief Общее состояние игры, прочитанное из снимка до применения.
+ */
+typedef struct SnapshotState_t {
+  uint64_t rng;                                  ///< Состояние генератора
+  uint8_t state;                                 ///< Состояние автомата
+  int32_t score;                                 ///< Результат
+  int32_t level;                                 ///< Уровень
+  int32_t speed;                                 ///< Скорость
+  uint8_t pause;                                 ///< Признак паузы
+  uint8_t next[MAX_GAMEBLOCK_SIZE][MAX_GAMEBLOCK_SIZE];  ///< Следующая фигура
+  FieldRow_t rows[FIELD_HEIGHT];                 ///< Маски строк поля
+  uint8_t colors[FIELD_HEIGHT][FIELD_WIDTH];     ///< Цвета клеток поля
+  uint8_t paused;                                ///< Признак паузы таймеров
+  SnapshotTimer_t timers[NUM_GAME_TIMERS];       ///< Таймеры
+} SnapshotState_t;
+
+void writeSnapshot(SnapshotWriter_t* writer, const void* bytes, size_t size) {
+  if (writer->failed || size > writer->size - writer->position) {
+    writer->failed = true;
+    return;
+  }
+
+  memcpy(writer->data + writer->position, bytes, size);
+  writer->position += size;
+}
+
+void readSnapshot(SnapshotReader_t* reader, void* bytes, size_t size) {
+  if (reader->failed || size > reader->size - reader->position) {
+    reader->failed = true;
+    memset(bytes, 0, size);
+    return;
+  }
+
+  memcpy(bytes, reader->data + reader->position, size);
+  reader->position += size;
+}
+
+void writeSnapshotBlock(SnapshotWriter_t* writer, const GameBlock_t* block) {
+  int8_t fields[] = {(int8_t)block->type, (int8_t)block->size,
+                     (int8_t)block->posX, (int8_t)block->posY,
+                     (int8_t)block->orientation};
+
+  writeSnapshot(writer, fields, sizeof(fields));
+}
+
+void readSnapshotBlock(SnapshotReader_t* reader, GameBlock_t* block) {
+  int8_t fields[5];
+
+  readSnapshot(reader, fields, sizeof(fields));
+  if (initGameBlock(block, fields[2], fields[3], fields[1],
+                    (gameBlockOrientation)fields[4], fields[0]) ||
+      fields[4] < ToTop || fields[4] > ToLeft)
+    reader->failed = true;
+}
+
+static void writeTimers(SnapshotWriter_t* writer,
+                        const GameTimerService_t* timers, int64_t now) {
+  // На паузе время до срока отсчитывается от начала паузы.
+  int64_t reference = timers->paused ? timers->pausedAt : now;
+  uint8_t paused = timers->paused;
+
+  WRITE_SNAPSHOT_VALUE(writer, paused);
+  for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+    const GameTimer_t* timer = &timers->timers[i];
+    SnapshotTimer_t saved = {timer->active, 0, timer->interval};
+    if (timer->active && timer->deadline > reference)
+      saved.remaining = timer->deadline - reference;
+    WRITE_SNAPSHOT_VALUE(writer, saved.active);
+    WRITE_SNAPSHOT_VALUE(writer, saved.remaining);
+    WRITE_SNAPSHOT_VALUE(writer, saved.interval);
+  }
+}
+
+size_t encodeGameSnapshot(uint8_t* data, size_t size,
+                          const GameTimerService_t* timers, int64_t now) {
+  GameInfo_t* info = locateGameInfo(NULL);
+  GameField_t* field = locateGameField(NULL);
+  GameRng_t* rng = locateGameRng(NULL);
+  FiniteStateMachine* fsm = locateFSM(NULL);
+  if (!data || !timers || !info || !field || !rng || !fsm) return 0;
+
+  SnapshotWriter_t writer = {data, size, 0, false};
+  uint8_t version = GAME_SNAPSHOT_VERSION;
+  uint8_t state = (uint8_t)fsm->currentState;
+  int32_t values[] = {info->score, info->level, info->speed};
+  uint8_t pause = (uint8_t)info->pause;
+  uint8_t next[MAX_GAMEBLOCK_SIZE][MAX_GAMEBLOCK_SIZE];
+
+  for (int y = 0; y < MAX_GAMEBLOCK_SIZE; y++) {
+    for (int x = 0; x < MAX_GAMEBLOCK_SIZE; x++)
+      next[y][x] = (uint8_t)info->next[y][x];
+  }
+
+  writeSnapshot(&writer, GAME_SNAPSHOT_MAGIC, MAGIC_SIZE);
+  WRITE_SNAPSHOT_VALUE(&writer, version);
+  WRITE_SNAPSHOT_VALUE(&writer, rng->state);
+  WRITE_SNAPSHOT_VALUE(&writer, state);
+  WRITE_SNAPSHOT_VALUE(&writer, values);
+  WRITE_SNAPSHOT_VALUE(&writer, pause);
+  WRITE_SNAPSHOT_VALUE(&writer, next);
+  WRITE_SNAPSHOT_VALUE(&writer, field->rows);
+  WRITE_SNAPSHOT_VALUE(&writer, field->colors);
+  writeTimers(&writer, timers, now);
+  encodeGameModel(&writer);
+
+  return writer.failed ? 0 : writer.position;
+}
+
+static void readState(SnapshotReader_t* reader, SnapshotState_t* state) {
+  int32_t values[3];
+
+  READ_SNAPSHOT_VALUE(reader, state->rng);
+  READ_SNAPSHOT_VALUE(reader, state->state);
+  READ_SNAPSHOT_VALUE(reader, values);
+  state->score = values[0];
+  state->level = values[1];
+  state->speed = values[2];
+  READ_SNAPSHOT_VALUE(reader, state->pause);
+  READ_SNAPSHOT_VALUE(reader, state->next);
+  READ_SNAPSHOT_VALUE(reader, state->rows);
+  READ_SNAPSHOT_VALUE(reader, state->colors);
+  READ_SNAPSHOT_VALUE(reader, state->paused);
+  for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+    READ_SNAPSHOT_VALUE(reader, state->timers[i].active);
+    READ_SNAPSHOT_VALUE(reader, state->timers[i].remaining);
+    READ_SNAPSHOT_VALUE(reader, state->timers[i].interval);
+  }
+}
+
+static bool isValidState(const SnapshotState_t* state,
+                         const GameField_t* field) {
+  // Нулевое состояние xorshift не изменяется (см. seedGameRng()). Снимок
+  // сохраняется только во время игры.
+  if (state->rng == 0 || state->state >= NUM_STATES ||
+      state->state == STATE_IDLE || state->state == STATE_START ||
+      state->state == STATE_GAME_OVER || state->state == STATE_TERMINATE ||
+      state->score < 0 || state->level < 1 || state->speed < 1 ||
+      state->pause > 1 || state->paused > 1)
+    return false;
+
+  // Стенки поля должны совпадать с текущей шириной поля.
+  for (int y = 0; y < FIELD_HEIGHT; y++) {
+    if ((state->rows[y] & field->emptyRow) != field->emptyRow) return false;
+  }
+
+  for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+    const SnapshotTimer_t* timer = &state->timers[i];
+    if (timer->active > 1 || timer->remaining < 0 ||
+        timer->remaining > MAX_TIMER_DELAY || timer->interval < 0 ||
+        timer->interval > MAX_TIMER_DELAY)
+      return false;
+  }
+
+  return true;
+}
+
+static void applyState(const SnapshotState_t* state, GameInfo_t* info,
+                       GameField_t* field, GameTimerService_t* timers,
+                       int64_t now) {
+  locateGameRng(NULL)->state = state->rng;
+  locateFSM(NULL)->currentState = state->state;
+  info->score = state->score;
+  info->level = state->level;
+  info->speed = state->speed;
+  info->pause = state->pause;
+  for (int y = 0; y < MAX_GAMEBLOCK_SIZE; y++) {
+    for (int x = 0; x < MAX_GAMEBLOCK_SIZE; x++)
+      info->next[y][x] = state->next[y][x];
+  }
+  memcpy(field->rows, state->rows, sizeof(field->rows));
+  memcpy(field->colors, state->colors, sizeof(field->colors));
+
+  initTimerService(timers);
+  for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+    const SnapshotTimer_t* timer = &state->timers[i];
+    timers->timers[i] = (GameTimer_t){now + timer->remaining, timer->interval,
+                                      timer->active != 0};
+  }
+  timers->paused = state->paused != 0;
+  timers->pausedAt = now;
+}
+
+int decodeGameSnapshot(const uint8_t* data, size_t size,
+                       GameTimerService_t* timers, int64_t now) {
+  GameInfo_t* info = locateGameInfo(NULL);
+  GameField_t* field = locateGameField(NULL);
+  if (!data || !timers || !info || !field || !locateGameRng(NULL) ||
+      !locateFSM(NULL))
+    return 1;
+
+  SnapshotReader_t reader = {data, size, 0, false};
+  char magic[MAGIC_SIZE];
+  uint8_t version = 0;
+  SnapshotState_t state;
+
+  readSnapshot(&reader, magic, MAGIC_SIZE);
+  READ_SNAPSHOT_VALUE(&reader, version);
+  if (reader.failed || memcmp(magic, GAME_SNAPSHOT_MAGIC, MAGIC_SIZE) ||
+      version != GAME_SNAPSHOT_VERSION)
+    return 1;
+
+  readState(&reader, &state);
+  if (reader.failed || !isValidState(&state, field)) return 1;
+
+  // Модель проверяет свою часть снимка по полю из снимка и применяет ее,
+  // только если она корректна и дочитана до конца, после этого
+  // применяется общая часть.
+  GameField_t saved = *field;
+  memcpy(saved.rows, state.rows, sizeof(saved.rows));
+  memcpy(saved.colors, state.colors, sizeof(saved.colors));
+  if (decodeGameModel(&reader, &saved)) return 1;
+  applyState(&state, info, field, timers, now);
+
+  return 0;
+}
+
+int saveGameSnapshot(const char* path, const GameTimerService_t* timers,
+                     int64_t now) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+  size_t size = encodeGameSnapshot(data, sizeof(data), timers, now);
+  if (!path || !size) return 1;
+
+  size_t length = strlen(path) + sizeof(TEMP_SUFFIX);
+  char* temp = malloc(length);
+  FILE* file = NULL;
+  if (temp) {
+    snprintf(temp, length, "%s%s", path, TEMP_SUFFIX);
+    file = fopen(temp, "wb");
+  }
+
+  bool saved = file && fwrite(data, 1, size, file) == size &&
+               !fflush(file) && !fsync(fileno(file));
+  if (file && fclose(file)) saved = false;
+  saved = saved && !rename(temp, path);
+  if (!saved && file) remove(temp);
+  free(temp);
+
+  return saved ? 0 : 1;
+}
+
+int loadGameSnapshot(const char* path, GameTimerService_t* timers,
+                     int64_t now) {
+  FILE* file = path ? fopen(path, "rb") : NULL;
+  if (!file) return 1;
+
+  // Лишний байт сверх максимального размера означает поврежденный файл.
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE + 1];
+  size_t size = fread(data, 1, sizeof(data), file);
+  bool failed = ferror(file) || size > GAME_SNAPSHOT_MAX_SIZE;
+  fclose(file);
+
+  return failed ? 1 : decodeGameSnapshot(data, size, timers, now);
+}
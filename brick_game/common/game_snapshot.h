@@ -0,0 +1,193 @@
+/**
+ * @file game_snapshot.h
+ * @brief Снимок состояния игры BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль сохраняет состояние игры в компактный двоичный снимок
+ * и восстанавливает его, минуя инициализацию новой игры (STATE_START):
+ * - заголовок: сигнатура GAME_SNAPSHOT_MAGIC и байт версии
+ *   GAME_SNAPSHOT_VERSION;
+ * - состояние генератора случайных чисел и текущее состояние автомата;
+ * - поля GameInfo_t (кроме лучшего результата, который хранит таблица
+ *   рекордов) и матрица следующей фигуры;
+ * - битовое поле (GameField_t);
+ * - таймеры: время до срока и период каждого таймера, признак паузы;
+ * - собственные данные модели игры (encodeGameModel(), decodeGameModel()):
+ *   фигуры Tetris или тело змейки Snake.
+ *
+ * Значения хранятся двоичными полями фиксированной ширины в порядке байтов
+ * машины, поэтому снимок переносим только между сборками одной платформы.
+ * Снимок Tetris занимает около 400 байт.
+ *
+ * Чтение — последовательное копирование полей с проверкой границ буфера
+ * (SnapshotReader_t) без разбора текста и выделения памяти. Снимок
+ * проверяется целиком (в том числе допустимость значений) до изменения
+ * состояния игры: поврежденный снимок не изменяет модель.
+ */
+
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "brick_game.h"
+#include "game_field.h"
+#include "game_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def GAME_SNAPSHOT_MAGIC
+ * @brief Сигнатура снимка (4 байта)
+ */
+#define GAME_SNAPSHOT_MAGIC "BGSS"
+
+/**
+ * @def GAME_SNAPSHOT_VERSION
+ * @brief Версия формата снимка
+ */
+#define GAME_SNAPSHOT_VERSION 1
+
+/**
+ * @def GAME_SNAPSHOT_MAX_SIZE
+ * @brief Максимальный размер снимка, байт
+ */
+#define GAME_SNAPSHOT_MAX_SIZE 2048
+
+/**
+ * @struct SnapshotWriter_t
+ * @brief Буфер записи снимка.
+ */
+typedef struct SnapshotWriter_t {
+  uint8_t* data;    ///< Буфер
+  size_t size;      ///< Размер буфера
+  size_t position;  ///< Количество записанных байт
+  bool failed;      ///< Признак переполнения буфера
+} SnapshotWriter_t;
+
+/**
+ * @struct SnapshotReader_t
+ * @brief Буфер чтения снимка.
+ */
+typedef struct SnapshotReader_t {
+  const uint8_t* data;  ///< Данные снимка
+  size_t size;          ///< Размер данных
+  size_t position;      ///< Количество прочитанных байт
+  bool failed;          ///< Признак выхода за границу данных
+} SnapshotReader_t;
+
+/**
+ * @def WRITE_SNAPSHOT_VALUE
+ * @brief Записывает переменную фиксированного размера в снимок.
+ */
+#define WRITE_SNAPSHOT_VALUE(writer, value) \
+  writeSnapshot((writer), &(value), sizeof(value))
+
+/**
+ * @def READ_SNAPSHOT_VALUE
+ * @brief Читает переменную фиксированного размера из снимка.
+ */
+#define READ_SNAPSHOT_VALUE(reader, value) \
+  readSnapshot((reader), &(value), sizeof(value))
+
+/**
+ * @defgroup SnapshotRoutines Функции снимка состояния игры
+ * @brief Функции записи и восстановления состояния игры
+ */
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Копирует `size` байт в буфер записи.
+ * @details При переполнении устанавливает признак `failed`.
+ */
+void writeSnapshot(SnapshotWriter_t* writer, const void* bytes, size_t size);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Копирует `size` байт из буфера чтения.
+ * @details При выходе за границу данных заполняет `bytes` нулями и
+ * устанавливает признак `failed`.
+ */
+void readSnapshot(SnapshotReader_t* reader, void* bytes, size_t size);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Записывает игровой блок (5 байт).
+ */
+void writeSnapshotBlock(SnapshotWriter_t* writer, const GameBlock_t* block);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Читает игровой блок.
+ * @details Проверяет только размер и ориентацию блока, допустимость
+ * положения и вида проверяет модель игры.
+ */
+void readSnapshotBlock(SnapshotReader_t* reader, GameBlock_t* block);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Записывает собственные данные модели игры.
+ * @details Реализуется моделью игры (tetris.c, snake.c).
+ */
+void encodeGameModel(SnapshotWriter_t* writer);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Восстанавливает собственные данные модели игры.
+ * @param field Поле из снимка (еще не примененное к игре).
+ * @return 0 в случае успеха, 1 если данные повреждены, прочитаны не
+ * полностью или не согласованы с полем (модель при этом не изменяется).
+ * @details Реализуется моделью игры (tetris.c, snake.c).
+ */
+int decodeGameModel(SnapshotReader_t* reader, const GameField_t* field);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Записывает снимок состояния игры в буфер.
+ * @param timers Таймеры игрового цикла.
+ * @param now Текущее время, нс.
+ * @return Размер снимка или 0 при нехватке места в буфере.
+ */
+size_t encodeGameSnapshot(uint8_t* data, size_t size,
+                          const GameTimerService_t* timers, int64_t now);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Восстанавливает состояние игры из снимка.
+ * @param timers Таймеры игрового цикла (сроки отсчитываются от `now`).
+ * @param now Текущее время, нс.
+ * @return 0 в случае успеха, 1 если снимок поврежден (состояние игры при
+ * этом не изменяется).
+ */
+int decodeGameSnapshot(const uint8_t* data, size_t size,
+                       GameTimerService_t* timers, int64_t now);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Записывает снимок в файл.
+ * @return 0 в случае успеха, 1 при ошибке.
+ * @details Снимок записывается во временный файл (`<path>.tmp`) и заменяет
+ * прежний переименованием, поэтому сбой записи не повреждает прежний снимок.
+ */
+int saveGameSnapshot(const char* path, const GameTimerService_t* timers,
+                     int64_t now);
+
+/**
+ * @ingroup SnapshotRoutines
+ * @brief Восстанавливает состояние игры из файла снимка.
+ * @return 0 в случае успеха, 1 если файл отсутствует или поврежден.
+ */
+int loadGameSnapshot(const char* path, GameTimerService_t* timers,
+                     int64_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
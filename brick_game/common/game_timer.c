@@ -1,28 +1,133 @@
+/**
+ * @file game_timer.c
+ * @brief Реализация службы таймеров.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
 #include "game_timer.h"
-#include <sys/time.h>
 
-uint64_t getCurrentTimeMs() {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (uint64_t)(tv.tv_sec) * 1000 + (uint64_t)(tv.tv_usec) / 1000;
+#include <stddef.h>
+#include <time.h>
+
+static bool isValidTimer(const GameTimerService_t* service, GameTimerID id) {
+  return service && (int)id >= 0 && id < NUM_GAME_TIMERS;
 }
 
-void initTimer(GameTimer_t* timer, uint64_t interval) {
-    timer->interval = interval;
-    timer->last_update = getCurrentTimeMs();
-    timer->paused = false;
+int64_t getMonotonicTime() {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t)now.tv_sec * NSEC_PER_SEC + now.tv_nsec;
 }
 
-bool checkTimer(GameTimer_t* timer) {
-    if (timer->paused) return false;
-    uint64_t now = getCurrentTimeMs();
-    if (now - timer->last_update >= timer->interval) {
-        timer->last_update = now;
-        return true;
-    }
-    return false;
+int64_t readGameClock(const GameClock_t* clock) {
+  return clock && clock->now ? clock->now(clock->context) : getMonotonicTime();
+}
+
+static int64_t readVirtualClock(void* context) {
+  return ((const VirtualClock_t*)context)->time;
+}
+
+GameClock_t virtualGameClock(VirtualClock_t* virtualClock) {
+  return (GameClock_t){readVirtualClock, virtualClock};
+}
+
+void advanceVirtualClock(VirtualClock_t* virtualClock, int64_t delta) {
+  if (virtualClock && delta > 0) virtualClock->time += delta;
+}
+
+void initTimerService(GameTimerService_t* service) {
+  for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+    service->timers[i] = (GameTimer_t){0, 0, false};
+  }
+  service->pausedAt = 0;
+  service->paused = false;
+}
+
+int startTimer(GameTimerService_t* service, GameTimerID id, int64_t delay,
+               int64_t interval, int64_t now) {
+  if (!isValidTimer(service, id) || delay < 0 || interval < 0) return 1;
+
+  // На паузе отсчет начинается с момента возобновления.
+  int64_t start = service->paused ? service->pausedAt : now;
+  service->timers[id] = (GameTimer_t){start + delay, interval, true};
+
+  return 0;
+}
+
+void stopTimer(GameTimerService_t* service, GameTimerID id) {
+  if (isValidTimer(service, id)) service->timers[id].active = false;
+}
+
+bool isTimerActive(const GameTimerService_t* service, GameTimerID id) {
+  return isValidTimer(service, id) && service->timers[id].active;
+}
+
+void setTimerInterval(GameTimerService_t* service, GameTimerID id,
+                      int64_t interval) {
+  if (isValidTimer(service, id) && interval >= 0)
+    service->timers[id].interval = interval;
+}
+
+static int earliestTimer(const GameTimerService_t* service) {
+  int earliest = TIMER_NONE;
+
+  for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+    const GameTimer_t* timer = &service->timers[i];
+    if (timer->active &&
+        (earliest == TIMER_NONE ||
+         timer->deadline < service->timers[earliest].deadline))
+      earliest = i;
+  }
+
+  return earliest;
+}
+
+int pollExpiredTimer(GameTimerService_t* service, int64_t now) {
+  if (!service || service->paused) return TIMER_NONE;
+
+  int id = earliestTimer(service);
+  if (id == TIMER_NONE || service->timers[id].deadline > now) return TIMER_NONE;
+
+  GameTimer_t* timer = &service->timers[id];
+  if (timer->interval == 0) {
+    timer->active = false;
+  } else if (now - timer->deadline >= timer->interval * TIMER_MAX_CATCH_UP) {
+    timer->deadline = now + timer->interval;
+  } else {
+    timer->deadline += timer->interval;
+  }
+
+  return id;
+}
+
+int64_t timeUntilNextTimer(const GameTimerService_t* service, int64_t now) {
+  if (!service || service->paused) return -1;
+
+  int id = earliestTimer(service);
+  if (id == TIMER_NONE) return -1;
+
+  int64_t remaining = service->timers[id].deadline - now;
+  return remaining > 0 ? remaining : 0;
+}
+
+void pauseTimerService(GameTimerService_t* service, int64_t now) {
+  if (service && !service->paused) {
+    service->pausedAt = now;
+    service->paused = true;
+  }
 }
 
-void pauseTimer(GameTimer_t* timer, bool state) {
-    timer->paused = state;
-}
\ No newline at end of file
+void resumeTimerService(GameTimerService_t* service, int64_t now) {
+  if (service && service->paused) {
+    int64_t shift = now - service->pausedAt;
+    for (int i = 0; i < NUM_GAME_TIMERS; i++) {
+      service->timers[i].deadline += shift;
+    }
+    service->paused = false;
+  }
+}
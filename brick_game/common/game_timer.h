@@ -3,44 +3,216 @@
  * @author provemet
  * @version 2
  * @date Декабрь 2024
- * 
- * @brief Реализация таймера BrickGame (Tetris, Snake)
  *
- * @details Этот модуль реализует общие для игр BrickGame (Tetris, Snake)
- * основные компоненты и методы.
+ * @brief Реализация таймеров BrickGame (Tetris, Snake)
+ *
+ * @details Этот модуль реализует службу таймеров с наносекундным разрешением
+ * на монотонных часах (CLOCK_MONOTONIC). Служба хранит набор именованных
+ * таймеров (GameTimerID): падение фигуры, задержка фиксации, автоповтор
+ * клавиш (DAS/ARR), анимация удаления строк, шаг змейки.
+ *
+ * Служба отвечает на вопрос «сколько времени до ближайшего срока»
+ * (timeUntilNextTimer()), поэтому игровой цикл ожидает ровно до следующего
+ * события. Периодические таймеры перезапускаются от предыдущего срока, а не
+ * от момента обработки, поэтому расписание не накапливает смещение. Пауза
+ * сдвигает сроки всех таймеров на длительность паузы.
+ *
+ * Таймеров немного, поэтому они хранятся в массиве, индексируемом
+ * идентификатором: поиск ближайшего срока — линейный проход по массиву из
+ * NUM_GAME_TIMERS элементов.
+ *
+ * Время передается функциям явно (параметр `now`), поэтому службу можно
+ * использовать с виртуальными часами (например, в тестах и симуляции).
+ * Источник времени игрового цикла задается структурой GameClock_t:
+ * монотонные часы по умолчанию или виртуальные часы (VirtualClock_t) при
+ * воспроизведении записи и в тестах.
  */
 
 #ifndef GAME_TIMER_H
 #define GAME_TIMER_H
 
-#include <stdint.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def NSEC_PER_SEC
+ * @brief Количество наносекунд в секунде
+ */
+#define NSEC_PER_SEC 1000000000ll
+
+/**
+ * @def NSEC_PER_USEC
+ * @brief Количество наносекунд в микросекунде
+ */
+#define NSEC_PER_USEC 1000ll
+
+/**
+ * @def NSEC_PER_MSEC
+ * @brief Количество наносекунд в миллисекунде
+ */
+#define NSEC_PER_MSEC 1000000ll
+
+/**
+ * @def TIMER_MAX_CATCH_UP
+ * @brief Максимальное отставание периодического таймера (в периодах)
+ * @details Если обработка отстала от расписания больше чем на указанное
+ * количество периодов (например, процесс был остановлен), пропущенные
+ * срабатывания отбрасываются и расписание начинается заново от текущего
+ * момента.
+ */
+#define TIMER_MAX_CATCH_UP 5
+
+/**
+ * @def TIMER_NONE
+ * @brief Признак отсутствия таймера (нет сработавших таймеров)
+ */
+#define TIMER_NONE (-1)
 
-typedef struct {
-    uint64_t last_update;  
-    uint64_t interval;     
-    bool paused;           
+/**
+ * @enum GameTimerID
+ * @brief Перечисление таймеров игры.
+ */
+typedef enum {
+  TIMER_GRAVITY,     ///< Падение фигуры (такт модели Tetris)
+  TIMER_LOCK_DELAY,  ///< Задержка фиксации фигуры
+  TIMER_DAS,         ///< Задержка перед автоповтором клавиши
+  TIMER_ARR,         ///< Период автоповтора клавиши
+  TIMER_LINE_CLEAR,  ///< Анимация удаления строк
+  TIMER_SNAKE_STEP,  ///< Шаг змейки (такт модели Snake)
+  NUM_GAME_TIMERS    ///< Количество таймеров
+} GameTimerID;
+
+/**
+ * @struct GameTimer_t
+ * @brief Структура одного таймера.
+ */
+typedef struct GameTimer_t {
+  int64_t deadline;  ///< Срок срабатывания, нс (монотонное время)
+  int64_t interval;  ///< Период, нс (0 — однократный таймер)
+  bool active;       ///< Признак запущенного таймера
 } GameTimer_t;
 
 /**
- * @brief Инициализирует таймер с заданным интервалом.
- * @param timer Указатель на структуру таймера.
- * @param interval Интервал срабатывания в миллисекундах.
+ * @struct GameTimerService_t
+ * @brief Структура службы таймеров.
+ */
+typedef struct GameTimerService_t {
+  GameTimer_t timers[NUM_GAME_TIMERS];  ///< Таймеры по идентификаторам
+  int64_t pausedAt;  ///< Момент начала паузы, нс
+  bool paused;       ///< Признак паузы
+} GameTimerService_t;
+
+/**
+ * @struct GameClock_t
+ * @brief Источник времени.
+ * @details Функция `now` возвращает текущее время в наносекундах для
+ * контекста `context`. Нулевая функция — монотонные часы (getMonotonicTime()).
  */
-void initTimer(GameTimer_t* timer, uint64_t interval);
+typedef struct GameClock_t {
+  int64_t (*now)(void* context);  ///< Функция чтения времени или NULL
+  void* context;                  ///< Данные источника времени
+} GameClock_t;
 
 /**
- * @brief Проверяет, истек ли интервал таймера.
- * @param timer Указатель на структуру таймера.
- * @return true, если интервал истек, иначе false.
+ * @struct VirtualClock_t
+ * @brief Виртуальные часы: время изменяется только явно.
  */
-bool checkTimer(GameTimer_t* timer);
+typedef struct VirtualClock_t {
+  int64_t time;  ///< Текущее время, нс
+} VirtualClock_t;
 
 /**
- * @brief Приостанавливает или возобновляет работу таймера.
- * @param timer Указатель на структуру таймера.
- * @param state true для приостановки, false для возобновления.
+ * @brief Возвращает текущее монотонное время (CLOCK_MONOTONIC) в наносекундах.
  */
-void pauseTimer(GameTimer_t* timer, bool state);
+int64_t getMonotonicTime();
+
+/**
+ * @brief Возвращает текущее время источника.
+ * @param clock Источник времени или NULL (монотонные часы).
+ */
+int64_t readGameClock(const GameClock_t* clock);
+
+/**
+ * @brief Возвращает источник времени виртуальных часов `virtualClock`.
+ */
+GameClock_t virtualGameClock(VirtualClock_t* virtualClock);
+
+/**
+ * @brief Переводит виртуальные часы вперед на `delta` наносекунд.
+ * @details Отрицательный сдвиг игнорируется: время не убывает.
+ */
+void advanceVirtualClock(VirtualClock_t* virtualClock, int64_t delta);
+
+/**
+ * @brief Инициализирует службу: все таймеры остановлены, пауза снята.
+ */
+void initTimerService(GameTimerService_t* service);
+
+/**
+ * @brief Запускает таймер.
+ * @param id Идентификатор таймера.
+ * @param delay Задержка до первого срабатывания, нс.
+ * @param interval Период повторных срабатываний, нс (0 — однократный).
+ * @param now Текущее время, нс.
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ */
+int startTimer(GameTimerService_t* service, GameTimerID id, int64_t delay,
+               int64_t interval, int64_t now);
+
+/**
+ * @brief Останавливает таймер.
+ */
+void stopTimer(GameTimerService_t* service, GameTimerID id);
+
+/**
+ * @brief Проверяет, запущен ли таймер.
+ */
+bool isTimerActive(const GameTimerService_t* service, GameTimerID id);
+
+/**
+ * @brief Изменяет период запущенного таймера.
+ * @details Новый период применяется со следующего перезапуска таймера,
+ * текущий срок не изменяется.
+ */
+void setTimerInterval(GameTimerService_t* service, GameTimerID id,
+                      int64_t interval);
+
+/**
+ * @brief Возвращает сработавший таймер с наиболее ранним сроком.
+ * @param now Текущее время, нс.
+ * @return Идентификатор таймера или TIMER_NONE.
+ * @details Периодический таймер перезапускается от своего срока (без
+ * накопления смещения), однократный — останавливается. Функция вызывается в
+ * цикле, пока не вернет TIMER_NONE. Во время паузы таймеры не срабатывают.
+ */
+int pollExpiredTimer(GameTimerService_t* service, int64_t now);
+
+/**
+ * @brief Возвращает время до ближайшего срока.
+ * @param now Текущее время, нс.
+ * @return Время в наносекундах (0, если срок уже наступил) или -1, если
+ * запущенных таймеров нет или служба на паузе.
+ */
+int64_t timeUntilNextTimer(const GameTimerService_t* service, int64_t now);
+
+/**
+ * @brief Приостанавливает все таймеры.
+ */
+void pauseTimerService(GameTimerService_t* service, int64_t now);
+
+/**
+ * @brief Возобновляет все таймеры.
+ * @details Сроки всех запущенных таймеров сдвигаются на длительность паузы,
+ * поэтому время, оставшееся до срабатывания, сохраняется точно.
+ */
+void resumeTimerService(GameTimerService_t* service, int64_t now);
+
+#ifdef __cplusplus
+}
+#endif
 
-#endif
\ No newline at end of file
+#endif
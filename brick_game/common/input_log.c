@@ -0,0 +1,181 @@
+/**
+ * @file input_log.c
+ * @brief Реализация записи и воспроизведения сессии.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "input_log.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "addr_locator.h"
+
+#define MAGIC_SIZE (sizeof(INPUT_LOG_MAGIC) - 1)
+#define VARINT_MAX_BYTES 10
+#define CODE_MASK ((1u << INPUT_LOG_CODE_BITS) - 1)
+#define MAX_DELTA (INT64_MAX >> INPUT_LOG_CODE_BITS)
+#define MAX_LOG_TIME (INT64_MAX / INPUT_LOG_TIME_UNIT)
+
+_Static_assert(INPUT_LOG_TICK_CODE <= CODE_MASK,
+               "INPUT_LOG_CODE_BITS is too small for event codes");
+
+struct InputLog_t {
+  FILE* file;         ///< Файл записи
+  GameClock_t clock;  ///< Источник времени событий
+  int64_t last;       ///< Время предыдущего события, INPUT_LOG_TIME_UNIT
+  bool failed;        ///< Признак ошибки записи
+};
+
+struct InputLogReader_t {
+  FILE* file;    ///< Файл записи
+  int64_t time;  ///< Время предыдущего события, INPUT_LOG_TIME_UNIT
+};
+
+static bool writeVarint(FILE* file, uint64_t value) {
+  while (value >= 0x80) {
+    if (fputc((int)(value & 0x7f) | 0x80, file) == EOF) return false;
+    value >>= 7;
+  }
+  return fputc((int)value, file) != EOF;
+}
+
+/*
+ * Возвращает INPUT_LOG_END, если файл закончился до первого байта числа,
+ * INPUT_LOG_CORRUPT — если внутри числа, число длиннее 64 бит или записано
+ * не кратчайшим образом (нулевой последний байт после продолжения).
+ */
+static InputLogStatus readVarint(FILE* file, uint64_t* value) {
+  *value = 0;
+  for (int i = 0; i < VARINT_MAX_BYTES; i++) {
+    int byte = fgetc(file);
+    if (byte == EOF) return i ? INPUT_LOG_CORRUPT : INPUT_LOG_END;
+
+    uint64_t bits = (uint64_t)(byte & 0x7f);
+    if ((i == VARINT_MAX_BYTES - 1 && bits > 1) || (i && byte == 0))
+      return INPUT_LOG_CORRUPT;
+    *value |= bits << (7 * i);
+    if (!(byte & 0x80)) return INPUT_LOG_OK;
+  }
+
+  return INPUT_LOG_CORRUPT;
+}
+
+static int64_t logTime(const InputLog_t* log) {
+  return readGameClock(&log->clock) / INPUT_LOG_TIME_UNIT;
+}
+
+static int logEvent(InputLog_t* log, unsigned code) {
+  if (!log || log->failed) return 1;
+
+  int64_t now = logTime(log);
+  int64_t delta = now - log->last;
+  if (delta < 0) delta = 0;
+  if (delta > MAX_DELTA) delta = MAX_DELTA;
+  log->last += delta;
+
+  uint64_t value = ((uint64_t)delta << INPUT_LOG_CODE_BITS) | code;
+  if (!writeVarint(log->file, value)) log->failed = true;
+
+  return log->failed ? 1 : 0;
+}
+
+InputLog_t* createInputLog(const char* path, uint64_t seed,
+                           const GameClock_t* clock) {
+  InputLog_t* log = path ? calloc(1, sizeof(InputLog_t)) : NULL;
+
+  if (log && !(log->file = fopen(path, "wb"))) {
+    free(log);
+    log = NULL;
+  }
+
+  if (log) {
+    if (clock) log->clock = *clock;
+    log->last = logTime(log);
+    if (fwrite(INPUT_LOG_MAGIC, 1, MAGIC_SIZE, log->file) != MAGIC_SIZE ||
+        fputc(INPUT_LOG_VERSION, log->file) == EOF ||
+        !writeVarint(log->file, seed))
+      log->failed = true;
+    locateInputLog(log);
+  }
+
+  return log;
+}
+
+int destroyInputLog(InputLog_t* log) {
+  if (!log) return 1;
+
+  if (log == locateInputLog(NULL)) locateInputLog(log);
+  int error = fclose(log->file) || log->failed;
+  free(log);
+
+  return error ? 1 : 0;
+}
+
+InputLog_t* locateInputLog(InputLog_t* log) {
+  static AddressLocator_t locator = {NULL, false};
+  AddressLocator_t* current = resolveLocator(&locator, LOCATOR_INPUT_LOG);
+  return (InputLog_t*)updateLocator(current, log);
+}
+
+int logUserAction(InputLog_t* log, UserAction_t action, bool hold) {
+  if ((int)action < Start || action > Action) return 1;
+
+  return logEvent(log, (unsigned)action * 2 + (hold ? 1 : 0));
+}
+
+int logModelTick(InputLog_t* log) { return logEvent(log, INPUT_LOG_TICK_CODE); }
+
+InputLogReader_t* openInputLog(const char* path, uint64_t* seed) {
+  FILE* file = path ? fopen(path, "rb") : NULL;
+  if (!file) return NULL;
+
+  char magic[MAGIC_SIZE];
+  uint64_t value = 0;
+  bool valid = fread(magic, 1, MAGIC_SIZE, file) == MAGIC_SIZE &&
+               !memcmp(magic, INPUT_LOG_MAGIC, MAGIC_SIZE) &&
+               fgetc(file) == INPUT_LOG_VERSION &&
+               readVarint(file, &value) == INPUT_LOG_OK;
+
+  InputLogReader_t* reader = NULL;
+  if (!valid || !(reader = calloc(1, sizeof(InputLogReader_t)))) {
+    fclose(file);
+  } else {
+    reader->file = file;
+    if (seed) *seed = value;
+  }
+
+  return reader;
+}
+
+void closeInputLog(InputLogReader_t* reader) {
+  if (reader) {
+    fclose(reader->file);
+    free(reader);
+  }
+}
+
+InputLogStatus readInputLogEvent(InputLogReader_t* reader,
+                                 InputLogEvent_t* event) {
+  if (!reader || !event) return INPUT_LOG_CORRUPT;
+
+  uint64_t value = 0;
+  InputLogStatus status = readVarint(reader->file, &value);
+  if (status != INPUT_LOG_OK) return status;
+
+  unsigned code = (unsigned)(value & CODE_MASK);
+  int64_t delta = (int64_t)(value >> INPUT_LOG_CODE_BITS);
+  if (code > INPUT_LOG_TICK_CODE || delta > MAX_LOG_TIME - reader->time)
+    return INPUT_LOG_CORRUPT;
+
+  bool tick = code == INPUT_LOG_TICK_CODE;
+  reader->time += delta;
+  event->time = reader->time * INPUT_LOG_TIME_UNIT;
+  event->type = tick ? INPUT_LOG_TICK : INPUT_LOG_ACTION;
+  event->action = tick ? Start : (UserAction_t)(code / 2);
+  event->hold = !tick && (code & 1);
+
+  return INPUT_LOG_OK;
+}
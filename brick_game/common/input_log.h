@@ -0,0 +1,189 @@
+/**
+ * @file input_log.h
+ * @brief Запись и воспроизведение сессии BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует компактную двоичную запись сессии игры.
+ * Модель детерминирована (game_rng.h), поэтому сессия полностью задается
+ * начальным значением генератора и последовательностью воздействий на
+ * модель: действий пользователя (userInput()) и тактов (fsm_update()).
+ * Такты записываются наравне с действиями: их расписание зависит от
+ * таймеров контроллера, и только порядок тактов относительно действий
+ * делает воспроизведение точным.
+ *
+ * Формат записи:
+ * - заголовок: сигнатура INPUT_LOG_MAGIC, байт версии INPUT_LOG_VERSION,
+ *   начальное значение генератора (varint);
+ * - события: одно число varint на событие, младшие INPUT_LOG_CODE_BITS бит
+ *   которого — код события (action * 2 + hold или INPUT_LOG_TICK_CODE), а
+ *   старшие — интервал от предыдущего события в микросекундах.
+ *
+ * Число varint (LEB128) хранится группами по 7 бит, начиная с младших;
+ * старший бит байта — признак продолжения. Такт модели раз в секунду
+ * занимает 4 байта, частые нажатия — 2–3 байта.
+ *
+ * Запись включается размещением журнала в локаторе (createInputLog()):
+ * userInput() записывает каждое действие, переданное модели, такты
+ * записывает игровой цикл (logModelTick()). Время событий читается из
+ * источника GameClock_t журнала.
+ */
+
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "brick_game.h"
+#include "game_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def INPUT_LOG_MAGIC
+ * @brief Сигнатура файла записи (4 байта)
+ */
+#define INPUT_LOG_MAGIC "BGIL"
+
+/**
+ * @def INPUT_LOG_VERSION
+ * @brief Версия формата записи
+ */
+#define INPUT_LOG_VERSION 1
+
+/**
+ * @def INPUT_LOG_CODE_BITS
+ * @brief Количество бит кода события в числе varint
+ */
+#define INPUT_LOG_CODE_BITS 5
+
+/**
+ * @def INPUT_LOG_TICK_CODE
+ * @brief Код события такта модели
+ */
+#define INPUT_LOG_TICK_CODE ((Action + 1) * 2)
+
+/**
+ * @def INPUT_LOG_TIME_UNIT
+ * @brief Единица интервалов между событиями, нс
+ */
+#define INPUT_LOG_TIME_UNIT NSEC_PER_USEC
+
+/**
+ * @enum InputLogEventType
+ * @brief Типы событий записи.
+ */
+typedef enum {
+  INPUT_LOG_ACTION,  ///< Действие пользователя (userInput())
+  INPUT_LOG_TICK     ///< Такт модели (fsm_update())
+} InputLogEventType;
+
+/**
+ * @enum InputLogStatus
+ * @brief Результат чтения события записи.
+ */
+typedef enum {
+  INPUT_LOG_OK,      ///< Событие прочитано
+  INPUT_LOG_END,     ///< Запись закончилась
+  INPUT_LOG_CORRUPT  ///< Запись повреждена или обрезана
+} InputLogStatus;
+
+/**
+ * @struct InputLogEvent_t
+ * @brief Событие записи.
+ */
+typedef struct InputLogEvent_t {
+  int64_t time;            ///< Время от начала записи, нс
+  InputLogEventType type;  ///< Тип события
+  UserAction_t action;     ///< Действие (для INPUT_LOG_ACTION)
+  bool hold;               ///< Признак удержания (для INPUT_LOG_ACTION)
+} InputLogEvent_t;
+
+/**
+ * @struct InputLog_t
+ * @brief Журнал записи сессии (структура скрыта в реализации).
+ */
+typedef struct InputLog_t InputLog_t;
+
+/**
+ * @struct InputLogReader_t
+ * @brief Чтение записи сессии (структура скрыта в реализации).
+ */
+typedef struct InputLogReader_t InputLogReader_t;
+
+/**
+ * @defgroup InputLogRoutines Функции записи и воспроизведения сессии
+ * @brief Функции создания журнала, записи и чтения событий
+ */
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Создает файл записи и размещает журнал в локаторе.
+ * @param path Путь к файлу записи.
+ * @param seed Начальное значение генератора модели.
+ * @param clock Источник времени событий или NULL (монотонные часы).
+ * @return Указатель на журнал или NULL при ошибке.
+ */
+InputLog_t* createInputLog(const char* path, uint64_t seed,
+                           const GameClock_t* clock);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Завершает запись, закрывает файл и освобождает журнал.
+ * @return 0 в случае успеха, 1 при ошибке записи файла.
+ */
+int destroyInputLog(InputLog_t* log);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Функция-локатор журнала записи.
+ */
+InputLog_t* locateInputLog(InputLog_t* log);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Записывает действие пользователя.
+ * @return 0 в случае успеха, 1 при ошибке.
+ */
+int logUserAction(InputLog_t* log, UserAction_t action, bool hold);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Записывает такт модели.
+ * @return 0 в случае успеха, 1 при ошибке.
+ */
+int logModelTick(InputLog_t* log);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Открывает запись для воспроизведения.
+ * @param path Путь к файлу записи.
+ * @param seed Начальное значение генератора модели из заголовка.
+ * @return Указатель на объект чтения или NULL при ошибке открытия файла или
+ * неверном заголовке.
+ */
+InputLogReader_t* openInputLog(const char* path, uint64_t* seed);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Закрывает запись и освобождает объект чтения.
+ */
+void closeInputLog(InputLogReader_t* reader);
+
+/**
+ * @ingroup InputLogRoutines
+ * @brief Читает следующее событие записи.
+ */
+InputLogStatus readInputLogEvent(InputLogReader_t* reader,
+                                 InputLogEvent_t* event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file input_queue.c
+ * @brief Реализация очереди событий ввода.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "input_queue.h"
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#define QUEUE_CACHE_LINE 64
+#define QUEUE_MASK (INPUT_QUEUE_CAPACITY - 1)
+
+_Static_assert((INPUT_QUEUE_CAPACITY & QUEUE_MASK) == 0,
+               "INPUT_QUEUE_CAPACITY must be a power of two");
+
+struct InputQueue_t {
+  alignas(QUEUE_CACHE_LINE) atomic_size_t head;  ///< Индекс чтения
+  alignas(QUEUE_CACHE_LINE) atomic_size_t tail;  ///< Индекс записи
+  alignas(QUEUE_CACHE_LINE) InputEvent_t events[INPUT_QUEUE_CAPACITY];
+};
+
+InputQueue_t* createInputQueue() {
+  InputQueue_t* queue = aligned_alloc(QUEUE_CACHE_LINE, sizeof(InputQueue_t));
+
+  if (queue) {
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+  }
+
+  return queue;
+}
+
+void destroyInputQueue(InputQueue_t* queue) { free(queue); }
+
+int pushInputEvent(InputQueue_t* queue, const InputEvent_t* event) {
+  if (!queue || !event) return 1;
+
+  size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  if (tail - head == INPUT_QUEUE_CAPACITY) return 1;
+
+  queue->events[tail & QUEUE_MASK] = *event;
+  // Событие становится видимым потребителю после записи.
+  atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+  return 0;
+}
+
+bool popInputEvent(InputQueue_t* queue, InputEvent_t* event) {
+  if (!queue || !event) return false;
+
+  size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+  if (head == tail) return false;
+
+  *event = queue->events[head & QUEUE_MASK];
+  // Ячейка освобождается для производителя после чтения.
+  atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+  return true;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file input_queue.h
+ * @brief Очередь событий ввода BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует кольцевую очередь событий ввода с одним
+ * производителем (поток чтения терминала) и одним потребителем (игровой
+ * цикл). Операции добавления и извлечения не используют блокировок и
+ * выполняются за конечное число шагов (wait-free): производитель изменяет
+ * только индекс хвоста, потребитель — только индекс головы, индексы
+ * размещены в разных кэш-линиях.
+ *
+ * Каждое событие хранит момент поступления (монотонное время), поэтому
+ * распознавание удержания клавиши не зависит от задержки обработки
+ * очереди. Заполненная очередь не перезаписывает события: производитель
+ * получает отказ и повторяет добавление после обработки очереди, поэтому
+ * нажатия не теряются и не объединяются.
+ */
+
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "brick_game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def INPUT_QUEUE_CAPACITY
+ * @brief Емкость очереди событий ввода (степень двойки)
+ */
+#define INPUT_QUEUE_CAPACITY 256
+
+/**
+ * @struct InputEvent_t
+ * @brief Событие ввода: действие пользователя и момент нажатия.
+ * @details Служебные клавиши контроллера (control не 0) проходят через ту же
+ * очередь, но не передаются модели; action в них не используется.
+ */
+typedef struct InputEvent_t {
+  int64_t time;         ///< Момент поступления, нс (CLOCK_MONOTONIC)
+  UserAction_t action;  ///< Действие пользователя
+  uint8_t control;      ///< Служебная клавиша контроллера (0 — действие)
+} InputEvent_t;
+
+/**
+ * @struct InputQueue_t
+ * @brief Очередь событий ввода (структура скрыта в реализации).
+ */
+typedef struct InputQueue_t InputQueue_t;
+
+/**
+ * @defgroup InputQueueRoutines Функции очереди событий ввода
+ * @brief Функции создания очереди, добавления и извлечения событий
+ */
+
+/**
+ * @ingroup InputQueueRoutines
+ * @brief Создает пустую очередь.
+ * @return Указатель на очередь или NULL при ошибке выделения памяти.
+ */
+InputQueue_t* createInputQueue();
+
+/**
+ * @ingroup InputQueueRoutines
+ * @brief Уничтожает очередь.
+ */
+void destroyInputQueue(InputQueue_t* queue);
+
+/**
+ * @ingroup InputQueueRoutines
+ * @brief Добавляет событие в очередь (только поток-производитель).
+ * @return 0 в случае успеха, 1 если очередь заполнена.
+ */
+int pushInputEvent(InputQueue_t* queue, const InputEvent_t* event);
+
+/**
+ * @ingroup InputQueueRoutines
+ * @brief Извлекает событие из очереди (только поток-потребитель).
+ * @return true, если событие извлечено, false, если очередь пуста.
+ */
+bool popInputEvent(InputQueue_t* queue, InputEvent_t* event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file key_repeat.c
+ * @brief Реализация распознавания удержания клавиш.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "key_repeat.h"
+
+static void releaseKey(KeyRepeat_t* repeat, GameTimerService_t* timers) {
+  repeat->down = false;
+  repeat->held = false;
+  stopTimer(timers, TIMER_DAS);
+  stopTimer(timers, TIMER_ARR);
+}
+
+void initKeyRepeat(KeyRepeat_t* repeat, int64_t das, int64_t arr) {
+  repeat->das = das;
+  repeat->arr = arr;
+  repeat->holdGap = KEY_HOLD_GAP_DEFAULT;
+  repeat->releaseTimeout = KEY_RELEASE_TIMEOUT_DEFAULT;
+  repeat->key = Start;
+  repeat->down = false;
+  repeat->held = false;
+  repeat->pressedAt = 0;
+  repeat->lastSeen = 0;
+}
+
+void processKeyEvent(KeyRepeat_t* repeat, GameTimerService_t* timers,
+                     const InputEvent_t* event, int64_t now) {
+  if (!isRepeatableAction(event->action)) {
+    userInput(event->action, false);
+    return;
+  }
+
+  if (repeat->down && repeat->key == event->action &&
+      event->time - repeat->lastSeen <= repeat->holdGap) {
+    repeat->lastSeen = event->time;
+    if (!repeat->held) {
+      // Автоповтор начинается через DAS от момента нажатия.
+      int64_t delay = repeat->pressedAt + repeat->das - now;
+      repeat->held = true;
+      startTimer(timers, TIMER_DAS, delay > 0 ? delay : 0, 0, now);
+    }
+    return;
+  }
+
+  releaseKey(repeat, timers);
+  repeat->key = event->action;
+  repeat->down = true;
+  repeat->pressedAt = event->time;
+  repeat->lastSeen = event->time;
+  userInput(event->action, false);
+}
+
+void processKeyTimer(KeyRepeat_t* repeat, GameTimerService_t* timers, int id,
+                     int64_t now) {
+  if ((id != TIMER_DAS && id != TIMER_ARR) || !repeat->held) return;
+
+  if (now - repeat->lastSeen > repeat->releaseTimeout) {
+    releaseKey(repeat, timers);
+    return;
+  }
+
+  userInput(repeat->key, true);
+  if (id == TIMER_DAS)
+    startTimer(timers, TIMER_ARR, repeat->arr, repeat->arr, now);
+}
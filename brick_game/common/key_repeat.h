@@ -0,0 +1,117 @@
+/**
+ * @file key_repeat.h
+ * @brief Распознавание удержания клавиш BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Терминал не сообщает об отпускании клавиши: удерживаемая клавиша
+ * порождает последовательность повторов с частотой автоповтора терминала.
+ * Модуль распознает нажатие, удержание и отпускание по меткам времени
+ * событий ввода (InputEvent_t):
+ * - событие клавиши, повторяемой моделью игры (isRepeatableAction(): в
+ *   Tetris — Left, Right, Down), после паузы больше holdGap — новое
+ *   нажатие, передается в модель сразу (hold = false);
+ * - повтор той же клавиши не позже holdGap после предыдущего — признак
+ *   удержания, сам повтор в модель не передается;
+ * - удерживаемая клавиша повторяется в модели (hold = true) по таймерам
+ *   TIMER_DAS (задержка от момента нажатия) и TIMER_ARR (период), поэтому
+ *   скорость перемещения не зависит от частоты автоповтора терминала;
+ * - отсутствие повторов дольше releaseTimeout — отпускание клавиши.
+ *
+ * Остальные действия (Start, Pause, Terminate, мгновенное падение Up в
+ * Tetris) передаются в модель при каждом событии. Нажатия чаще holdGap
+ * одной и той же клавиши неотличимы от автоповтора терминала, поэтому
+ * holdGap выбирается меньше периода самых быстрых повторных нажатий и
+ * больше периода автоповтора.
+ */
+
+#ifndef KEY_REPEAT_H
+#define KEY_REPEAT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game_timer.h"
+#include "input_queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def KEY_DAS_DEFAULT
+ * @brief Задержка до начала автоповтора (DAS), нс
+ */
+#define KEY_DAS_DEFAULT (170 * NSEC_PER_MSEC)
+
+/**
+ * @def KEY_ARR_DEFAULT
+ * @brief Период автоповтора (ARR), нс
+ */
+#define KEY_ARR_DEFAULT (50 * NSEC_PER_MSEC)
+
+/**
+ * @def KEY_HOLD_GAP_DEFAULT
+ * @brief Максимальный интервал между повторами удерживаемой клавиши, нс
+ */
+#define KEY_HOLD_GAP_DEFAULT (75 * NSEC_PER_MSEC)
+
+/**
+ * @def KEY_RELEASE_TIMEOUT_DEFAULT
+ * @brief Интервал без повторов, после которого клавиша отпущена, нс
+ */
+#define KEY_RELEASE_TIMEOUT_DEFAULT (100 * NSEC_PER_MSEC)
+
+/**
+ * @struct KeyRepeat_t
+ * @brief Состояние распознавания удержания клавиши.
+ */
+typedef struct KeyRepeat_t {
+  int64_t das;             ///< Задержка до начала автоповтора, нс
+  int64_t arr;             ///< Период автоповтора, нс
+  int64_t holdGap;         ///< Максимальный интервал повторов, нс
+  int64_t releaseTimeout;  ///< Интервал отпускания клавиши, нс
+  UserAction_t key;        ///< Последняя нажатая повторяемая клавиша
+  bool down;               ///< Признак нажатой клавиши
+  bool held;               ///< Признак удержания (получены повторы)
+  int64_t pressedAt;       ///< Момент нажатия, нс
+  int64_t lastSeen;        ///< Момент последнего повтора, нс
+} KeyRepeat_t;
+
+/**
+ * @defgroup KeyRepeatRoutines Функции распознавания удержания клавиш
+ * @brief Функции обработки событий ввода и таймеров автоповтора
+ */
+
+/**
+ * @ingroup KeyRepeatRoutines
+ * @brief Инициализирует состояние с заданными DAS и ARR.
+ * @details Интервалы повторов и отпускания устанавливаются по умолчанию.
+ */
+void initKeyRepeat(KeyRepeat_t* repeat, int64_t das, int64_t arr);
+
+/**
+ * @ingroup KeyRepeatRoutines
+ * @brief Обрабатывает событие ввода.
+ * @param timers Служба таймеров (TIMER_DAS, TIMER_ARR).
+ * @param now Текущее время, нс.
+ * @details Нажатия передаются в модель функцией userInput().
+ */
+void processKeyEvent(KeyRepeat_t* repeat, GameTimerService_t* timers,
+                     const InputEvent_t* event, int64_t now);
+
+/**
+ * @ingroup KeyRepeatRoutines
+ * @brief Обрабатывает срабатывание таймера автоповтора.
+ * @param id Идентификатор сработавшего таймера (другие игнорируются).
+ * @param now Текущее время, нс.
+ */
+void processKeyTimer(KeyRepeat_t* repeat, GameTimerService_t* timers, int id,
+                     int64_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
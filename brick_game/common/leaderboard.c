@@ -0,0 +1,254 @@
+/**
+ * @file leaderboard.c
+ * @brief Реализация таблицы рекордов.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "leaderboard.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+#define TEMP_SUFFIX ".tmp"
+#define LOCK_SUFFIX ".lock"
+#define FILE_MODE 0644
+
+struct Leaderboard_t {
+  const LeaderboardFile_t* file;  ///< Отображение файла или NULL
+  LeaderboardTable_t empty;       ///< Таблица при отсутствии файла
+};
+
+static bool isValidGame(LeaderboardGame game) {
+  return (int)game >= 0 && game < NUM_LEADERBOARD_GAMES;
+}
+
+static uint32_t tablesChecksum(const LeaderboardFile_t* file) {
+  const unsigned char* bytes = (const unsigned char*)file->tables;
+  uint32_t hash = FNV_OFFSET_BASIS;
+
+  for (size_t i = 0; i < sizeof(file->tables); i++) {
+    hash ^= bytes[i];
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+// Записи таблицы положительны и упорядочены по убыванию результата.
+static bool isValidTable(const LeaderboardTable_t* table) {
+  if (table->count > LEADERBOARD_SIZE || table->reserved) return false;
+
+  for (uint32_t i = 0; i < table->count; i++) {
+    int32_t score = table->entries[i].score;
+    if (score <= 0 || (i && score > table->entries[i - 1].score))
+      return false;
+  }
+
+  return true;
+}
+
+static bool isValidFile(const LeaderboardFile_t* file) {
+  if (file->magic != LEADERBOARD_MAGIC ||
+      file->version != LEADERBOARD_VERSION || file->size != LEADERBOARD_SIZE)
+    return false;
+
+  for (int game = 0; game < NUM_LEADERBOARD_GAMES; game++) {
+    if (!isValidTable(&file->tables[game])) return false;
+  }
+
+  return file->checksum == tablesChecksum(file);
+}
+
+/*
+ * Файл заменяется только переименованием и не изменяется на месте, поэтому
+ * проверенное отображение остается целым до munmap().
+ */
+static const LeaderboardFile_t* mapFile(const char* path) {
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return NULL;
+
+  struct stat status;
+  void* address = MAP_FAILED;
+  if (!fstat(fd, &status) && status.st_size == sizeof(LeaderboardFile_t))
+    address = mmap(NULL, sizeof(LeaderboardFile_t), PROT_READ, MAP_SHARED, fd,
+                   0);
+  close(fd);
+  if (address == MAP_FAILED) return NULL;
+
+  if (!isValidFile(address)) {
+    munmap(address, sizeof(LeaderboardFile_t));
+    address = NULL;
+  }
+
+  return address;
+}
+
+static void unmapFile(const LeaderboardFile_t* file) {
+  if (file) munmap((void*)file, sizeof(LeaderboardFile_t));
+}
+
+Leaderboard_t* openLeaderboard(const char* path) {
+  Leaderboard_t* board = calloc(1, sizeof(Leaderboard_t));
+
+  if (board && path) board->file = mapFile(path);
+
+  return board;
+}
+
+void closeLeaderboard(Leaderboard_t* board) {
+  if (board) {
+    unmapFile(board->file);
+    free(board);
+  }
+}
+
+const LeaderboardTable_t* getLeaderboardTable(const Leaderboard_t* board,
+                                              LeaderboardGame game) {
+  if (!board || !isValidGame(game)) return NULL;
+
+  return board->file ? &board->file->tables[game] : &board->empty;
+}
+
+int getLeaderboardHighScore(const Leaderboard_t* board, LeaderboardGame game) {
+  const LeaderboardTable_t* table = getLeaderboardTable(board, game);
+
+  return table && table->count ? table->entries[0].score : 0;
+}
+
+// Равные результаты упорядочены по времени добавления.
+static bool insertEntry(LeaderboardTable_t* table,
+                        const LeaderboardEntry_t* entry) {
+  uint32_t position = table->count;
+  while (position > 0 && table->entries[position - 1].score < entry->score)
+    position--;
+  if (position >= LEADERBOARD_SIZE) return false;
+
+  uint32_t last =
+      table->count < LEADERBOARD_SIZE ? table->count : LEADERBOARD_SIZE - 1;
+  memmove(&table->entries[position + 1], &table->entries[position],
+          (last - position) * sizeof(LeaderboardEntry_t));
+  table->entries[position] = *entry;
+  if (table->count < LEADERBOARD_SIZE) table->count++;
+
+  return true;
+}
+
+static char* suffixedPath(const char* path, const char* suffix) {
+  size_t size = strlen(path) + strlen(suffix) + 1;
+  char* result = malloc(size);
+
+  if (result) snprintf(result, size, "%s%s", path, suffix);
+
+  return result;
+}
+
+static bool writeAll(int fd, const void* data, size_t size) {
+  const char* bytes = data;
+
+  while (size > 0) {
+    ssize_t written = write(fd, bytes, size);
+    if (written < 0 && errno == EINTR) continue;
+    if (written <= 0) return false;
+    bytes += written;
+    size -= (size_t)written;
+  }
+
+  return true;
+}
+
+// Запись каталога фиксирует переименование файла на диске.
+static bool syncDirectory(const char* path) {
+  char* copy = strdup(path);
+  int fd = copy ? open(dirname(copy), O_RDONLY | O_DIRECTORY | O_CLOEXEC) : -1;
+
+  free(copy);
+  if (fd < 0) return false;
+  bool synced = fsync(fd) == 0;
+  close(fd);
+
+  return synced;
+}
+
+static int commitFile(const char* path, const LeaderboardFile_t* file) {
+  char* temp = suffixedPath(path, TEMP_SUFFIX);
+  int fd = temp ? open(temp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                       FILE_MODE)
+                : -1;
+  bool committed = fd >= 0 && writeAll(fd, file, sizeof(*file)) && !fsync(fd);
+
+  if (fd >= 0 && close(fd)) committed = false;
+  committed = committed && !rename(temp, path);
+  if (!committed && fd >= 0) unlink(temp);
+  free(temp);
+
+  return committed && syncDirectory(path) ? 0 : 1;
+}
+
+static int lockFile(const char* path) {
+  char* lockPath = suffixedPath(path, LOCK_SUFFIX);
+  int fd = lockPath ? open(lockPath, O_RDWR | O_CREAT | O_CLOEXEC, FILE_MODE)
+                    : -1;
+
+  free(lockPath);
+  while (fd >= 0 && flock(fd, LOCK_EX)) {
+    if (errno != EINTR) {
+      close(fd);
+      fd = -1;
+    }
+  }
+
+  return fd;
+}
+
+static void unlockFile(int fd) {
+  flock(fd, LOCK_UN);
+  close(fd);
+}
+
+int submitLeaderboardScore(const char* path, LeaderboardGame game,
+                           const LeaderboardEntry_t* entry) {
+  if (!path || !entry || !isValidGame(game)) return 1;
+  if (entry->score <= 0) return 0;
+
+  int lock = lockFile(path);
+  if (lock < 0) return 1;
+
+  // Под блокировкой таблица перечитывается: обновления других процессов
+  // между открытием таблицы и добавлением результата сохраняются.
+  LeaderboardFile_t file;
+  const LeaderboardFile_t* current = mapFile(path);
+  if (current) {
+    file = *current;
+    unmapFile(current);
+  } else {
+    memset(&file, 0, sizeof(file));
+    file.magic = LEADERBOARD_MAGIC;
+    file.version = LEADERBOARD_VERSION;
+    file.size = LEADERBOARD_SIZE;
+  }
+
+  int error = 0;
+  if (insertEntry(&file.tables[game], entry)) {
+    file.generation++;
+    file.checksum = tablesChecksum(&file);
+    error = commitFile(path, &file);
+  }
+  unlockFile(lock);
+
+  return error;
+}
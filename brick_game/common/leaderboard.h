@@ -0,0 +1,152 @@
+/**
+ * @file leaderboard.h
+ * @brief Таблица рекордов BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль хранит лучшие результаты игр (LEADERBOARD_SIZE
+ * записей для каждой игры) в файле фиксированного формата
+ * (LeaderboardFile_t): заголовок с сигнатурой, версией, количеством записей
+ * и контрольной суммой таблиц, затем таблицы игр. Числа хранятся в порядке
+ * байтов машины: файл предназначен для одной машины.
+ *
+ * Чтение — отображение файла в память (mmap) и проверка заголовка,
+ * таблиц (положительные результаты по убыванию) и контрольной суммы, после
+ * которой таблицы используются без разбора.
+ * Поврежденный или отсутствующий файл читается как пустая таблица.
+ *
+ * Обновление атомарно: новое содержимое записывается во временный файл
+ * (`<path>.tmp`), сбрасывается на диск (fsync) и заменяет прежний файл
+ * переименованием (rename). Сбой во время обновления оставляет прежний файл
+ * целым, а ранее созданные отображения продолжают видеть прежнее
+ * содержимое. Обновления разных процессов упорядочены блокировкой (flock)
+ * файла `<path>.lock`: под блокировкой таблица перечитывается, поэтому
+ * одновременные обновления не теряются.
+ */
+
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def LEADERBOARD_MAGIC
+ * @brief Сигнатура файла таблицы рекордов ("BGLB")
+ */
+#define LEADERBOARD_MAGIC 0x424C4742u
+
+/**
+ * @def LEADERBOARD_VERSION
+ * @brief Версия формата файла
+ */
+#define LEADERBOARD_VERSION 1
+
+/**
+ * @def LEADERBOARD_SIZE
+ * @brief Количество записей таблицы одной игры
+ */
+#define LEADERBOARD_SIZE 10
+
+/**
+ * @enum LeaderboardGame
+ * @brief Игры, результаты которых хранятся в таблице.
+ */
+typedef enum {
+  LEADERBOARD_TETRIS,   ///< Tetris
+  LEADERBOARD_SNAKE,    ///< Snake
+  NUM_LEADERBOARD_GAMES ///< Количество игр
+} LeaderboardGame;
+
+/**
+ * @struct LeaderboardEntry_t
+ * @brief Запись таблицы рекордов.
+ */
+typedef struct LeaderboardEntry_t {
+  int32_t score;  ///< Результат
+  int32_t level;  ///< Достигнутый уровень
+  int64_t time;   ///< Время окончания игры, с (Unix time)
+} LeaderboardEntry_t;
+
+/**
+ * @struct LeaderboardTable_t
+ * @brief Таблица рекордов одной игры (по убыванию результата).
+ */
+typedef struct LeaderboardTable_t {
+  uint32_t count;  ///< Количество заполненных записей
+  uint32_t reserved;  ///< Выравнивание (0)
+  LeaderboardEntry_t entries[LEADERBOARD_SIZE];  ///< Записи
+} LeaderboardTable_t;
+
+/**
+ * @struct LeaderboardFile_t
+ * @brief Содержимое файла таблицы рекордов.
+ */
+typedef struct LeaderboardFile_t {
+  uint32_t magic;       ///< LEADERBOARD_MAGIC
+  uint16_t version;     ///< LEADERBOARD_VERSION
+  uint16_t size;        ///< LEADERBOARD_SIZE
+  uint32_t generation;  ///< Количество обновлений файла
+  uint32_t checksum;    ///< Контрольная сумма таблиц (FNV-1a)
+  LeaderboardTable_t tables[NUM_LEADERBOARD_GAMES];  ///< Таблицы игр
+} LeaderboardFile_t;
+
+/**
+ * @struct Leaderboard_t
+ * @brief Отображенная в память таблица рекордов (структура скрыта в
+ * реализации).
+ */
+typedef struct Leaderboard_t Leaderboard_t;
+
+/**
+ * @defgroup LeaderboardRoutines Функции таблицы рекордов
+ * @brief Функции чтения и обновления таблицы рекордов
+ */
+
+/**
+ * @ingroup LeaderboardRoutines
+ * @brief Отображает файл таблицы рекордов в память.
+ * @return Указатель на таблицу или NULL при ошибке выделения памяти.
+ * @details Отсутствующий или поврежденный файл дает пустую таблицу.
+ */
+Leaderboard_t* openLeaderboard(const char* path);
+
+/**
+ * @ingroup LeaderboardRoutines
+ * @brief Освобождает отображение таблицы.
+ */
+void closeLeaderboard(Leaderboard_t* board);
+
+/**
+ * @ingroup LeaderboardRoutines
+ * @brief Возвращает таблицу игры.
+ * @return Указатель на таблицу (действителен до closeLeaderboard()) или NULL
+ * для неизвестной игры.
+ */
+const LeaderboardTable_t* getLeaderboardTable(const Leaderboard_t* board,
+                                              LeaderboardGame game);
+
+/**
+ * @ingroup LeaderboardRoutines
+ * @brief Возвращает лучший результат игры (0 для пустой таблицы).
+ */
+int getLeaderboardHighScore(const Leaderboard_t* board, LeaderboardGame game);
+
+/**
+ * @ingroup LeaderboardRoutines
+ * @brief Добавляет результат в таблицу игры и атомарно обновляет файл.
+ * @return 0 в случае успеха (в том числе если результат не попадает в
+ * таблицу), 1 при ошибке параметров, блокировки или записи файла.
+ */
+int submitLeaderboardScore(const char* path, LeaderboardGame game,
+                           const LeaderboardEntry_t* entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
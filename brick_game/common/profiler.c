@@ -0,0 +1,136 @@
+/**
+ * @file profiler.c
+ * @brief Реализация измерения времени выполнения участков кадра.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "profiler.h"
+
+#include <string.h>
+
+#define SUB_BUCKET_COUNT (1 << PROFILE_SUB_BUCKET_BITS)
+#define MAX_PROFILE_VALUE ((INT64_C(1) << (PROFILE_MAX_EXPONENT + 1)) - 1)
+
+static _Thread_local ProfileHistogram_t histograms[NUM_PROFILE_ZONES];
+
+static const char* const zoneNames[NUM_PROFILE_ZONES] = {
+    "fsm_update", "fsm_trigger", "model_copy",
+    "view_refresh", "view_render", "frame"};
+
+static bool isValidZone(ProfileZone zone) {
+  return (int)zone >= 0 && zone < NUM_PROFILE_ZONES;
+}
+
+static int highestBit(uint64_t value) {
+  int bit = 0;
+  while (value >>= 1) bit++;
+  return bit;
+}
+
+/*
+ * Значения меньше SUB_BUCKET_COUNT хранятся точно, остальные — в интервале,
+ * определяемом старшим битом и следующими PROFILE_SUB_BUCKET_BITS битами.
+ */
+static int bucketIndex(int64_t value) {
+  if (value < SUB_BUCKET_COUNT) return (int)value;
+
+  int exponent = highestBit((uint64_t)value);
+  int shift = exponent - PROFILE_SUB_BUCKET_BITS;
+  int mantissa = (int)(value >> shift) - SUB_BUCKET_COUNT;
+
+  return (shift + 1) * SUB_BUCKET_COUNT + mantissa;
+}
+
+static int64_t bucketUpperBound(int index) {
+  if (index < SUB_BUCKET_COUNT) return index;
+
+  int shift = index / SUB_BUCKET_COUNT - 1;
+  int64_t mantissa = SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT;
+
+  return ((mantissa + 1) << shift) - 1;
+}
+
+void recordProfileSample(ProfileZone zone, int64_t duration) {
+  if (!isValidZone(zone)) return;
+
+  ProfileHistogram_t* histogram = &histograms[zone];
+  if (duration < 0) duration = 0;
+  if (histogram->count == 0 || duration < histogram->min)
+    histogram->min = duration;
+  if (duration > histogram->max) histogram->max = duration;
+  histogram->total += duration;
+  histogram->count++;
+  if (duration > MAX_PROFILE_VALUE) duration = MAX_PROFILE_VALUE;
+  histogram->buckets[bucketIndex(duration)]++;
+}
+
+void resetProfiler() { memset(histograms, 0, sizeof(histograms)); }
+
+const ProfileHistogram_t* getProfileHistogram(ProfileZone zone) {
+  return isValidZone(zone) ? &histograms[zone] : NULL;
+}
+
+int64_t profilePercentile(const ProfileHistogram_t* histogram,
+                          double percentile) {
+  if (!histogram || histogram->count == 0) return 0;
+
+  uint64_t rank = (uint64_t)(percentile / 100.0 * histogram->count + 0.5);
+  if (rank < 1) rank = 1;
+  if (rank > histogram->count) rank = histogram->count;
+
+  uint64_t seen = 0;
+  for (int i = 0; i < PROFILE_NUM_BUCKETS; i++) {
+    seen += histogram->buckets[i];
+    if (seen >= rank) {
+      int64_t bound = bucketUpperBound(i);
+      return bound < histogram->max ? bound : histogram->max;
+    }
+  }
+
+  return histogram->max;
+}
+
+int getProfileStats(ProfileZone zone, ProfileStats_t* stats) {
+  if (!isValidZone(zone) || !stats) return 1;
+
+  const ProfileHistogram_t* histogram = &histograms[zone];
+  stats->count = histogram->count;
+  stats->min = histogram->min;
+  stats->p50 = profilePercentile(histogram, 50.0);
+  stats->p99 = profilePercentile(histogram, 99.0);
+  stats->max = histogram->max;
+  stats->mean =
+      histogram->count ? histogram->total / (int64_t)histogram->count : 0;
+
+  return 0;
+}
+
+const char* profileZoneName(ProfileZone zone) {
+  return isValidZone(zone) ? zoneNames[zone] : "unknown";
+}
+
+void printProfileReport(FILE* stream) {
+  fprintf(stream, "%-13s %10s %10s %10s %10s %10s %10s\n", "zone", "count",
+          "min,ns", "p50,ns", "p99,ns", "max,ns", "mean,ns");
+  for (int zone = 0; zone < NUM_PROFILE_ZONES; zone++) {
+    ProfileStats_t stats;
+    getProfileStats((ProfileZone)zone, &stats);
+    fprintf(stream, "%-13s %10llu %10lld %10lld %10lld %10lld %10lld\n",
+            profileZoneName((ProfileZone)zone),
+            (unsigned long long)stats.count, (long long)stats.min,
+            (long long)stats.p50, (long long)stats.p99, (long long)stats.max,
+            (long long)stats.mean);
+  }
+}
+
+int saveProfileReport(const char* path) {
+  FILE* file = path ? fopen(path, "w") : NULL;
+  if (!file) return 1;
+
+  printProfileReport(file);
+  int error = ferror(file);
+
+  return fclose(file) || error ? 1 : 0;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file profiler.h
+ * @brief Измерение времени выполнения участков кадра BrickGame
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует накопление длительностей выполнения
+ * участков игрового кадра (обновление автомата, обработка триггеров,
+ * копирование состояния модели в представление, отрисовка) в гистограммах
+ * фиксированного размера с логарифмически-линейными интервалами (по образцу
+ * HDR Histogram): каждый интервал [2^e, 2^(e+1)) делится на
+ * 2^PROFILE_SUB_BUCKET_BITS равных частей, поэтому относительная
+ * погрешность процентилей не превышает 2^-PROFILE_SUB_BUCKET_BITS при любом
+ * диапазоне значений, а запись замера — несколько целочисленных операций.
+ *
+ * Замеры включаются при сборке с макросом BRICKGAME_PROFILE: `make build
+ * PROFILE=1` для модели и симуляции, `make game PROFILE=1` в корне проекта
+ * для модели и контроллера терминальной игры. Без него макросы
+ * PROFILE_BEGIN(), PROFILE_END() и PROFILE_SCOPE() раскрываются в пустые
+ * выражения, и замеры не добавляют накладных расходов.
+ *
+ * Гистограммы хранятся отдельно для каждого потока, поэтому замеры в
+ * многопоточной симуляции не требуют синхронизации.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "game_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def PROFILE_SUB_BUCKET_BITS
+ * @brief Количество бит точности интервала гистограммы
+ */
+#define PROFILE_SUB_BUCKET_BITS 4
+
+/**
+ * @def PROFILE_MAX_EXPONENT
+ * @brief Показатель степени двойки максимального значения, нс
+ * @details Большие значения учитываются в последнем интервале.
+ */
+#define PROFILE_MAX_EXPONENT 40
+
+/**
+ * @def PROFILE_NUM_BUCKETS
+ * @brief Количество интервалов гистограммы
+ */
+#define PROFILE_NUM_BUCKETS                                  \
+  ((PROFILE_MAX_EXPONENT - PROFILE_SUB_BUCKET_BITS + 2) << \
+   PROFILE_SUB_BUCKET_BITS)
+
+/**
+ * @enum ProfileZone
+ * @brief Измеряемые участки кадра.
+ */
+typedef enum {
+  PROFILE_FSM_UPDATE,    ///< Такт модели (fsm_update)
+  PROFILE_FSM_TRIGGER,   ///< Обработка триггера (fsm_processTrigger)
+  PROFILE_MODEL_COPY,    ///< Копирование состояния модели (updateCurrentState)
+  PROFILE_VIEW_REFRESH,  ///< Передача данных элементам представления
+  PROFILE_VIEW_RENDER,   ///< Вывод кадра представлением
+  PROFILE_FRAME,         ///< Кадр игрового цикла целиком
+  NUM_PROFILE_ZONES      ///< Количество участков
+} ProfileZone;
+
+/**
+ * @struct ProfileHistogram_t
+ * @brief Гистограмма длительностей одного участка.
+ */
+typedef struct ProfileHistogram_t {
+  uint32_t buckets[PROFILE_NUM_BUCKETS];  ///< Количество замеров в интервалах
+  uint64_t count;  ///< Количество замеров
+  int64_t min;     ///< Минимальная длительность, нс
+  int64_t max;     ///< Максимальная длительность, нс
+  int64_t total;   ///< Суммарная длительность, нс
+} ProfileHistogram_t;
+
+/**
+ * @struct ProfileStats_t
+ * @brief Сводные показатели участка.
+ * @details Процентили — верхние границы интервалов гистограммы.
+ */
+typedef struct ProfileStats_t {
+  uint64_t count;  ///< Количество замеров
+  int64_t min;     ///< Минимальная длительность, нс
+  int64_t p50;     ///< Медиана, нс
+  int64_t p99;     ///< 99-й процентиль, нс
+  int64_t max;     ///< Максимальная длительность, нс
+  int64_t mean;    ///< Среднее, нс
+} ProfileStats_t;
+
+/**
+ * @defgroup ProfilerRoutines Функции измерения времени
+ * @brief Функции записи замеров и получения статистики
+ */
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Добавляет замер в гистограмму участка текущего потока.
+ * @param duration Длительность, нс (отрицательные значения считаются 0).
+ */
+void recordProfileSample(ProfileZone zone, int64_t duration);
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Очищает гистограммы текущего потока.
+ */
+void resetProfiler();
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Возвращает гистограмму участка текущего потока.
+ * @return Указатель на гистограмму или NULL для неизвестного участка.
+ */
+const ProfileHistogram_t* getProfileHistogram(ProfileZone zone);
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Вычисляет сводные показатели участка текущего потока.
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ */
+int getProfileStats(ProfileZone zone, ProfileStats_t* stats);
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Возвращает значение процентиля гистограммы.
+ * @param percentile Процентиль (0..100).
+ * @return Верхняя граница интервала процентиля, нс (0 без замеров).
+ */
+int64_t profilePercentile(const ProfileHistogram_t* histogram,
+                          double percentile);
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Возвращает имя участка для отчетов.
+ */
+const char* profileZoneName(ProfileZone zone);
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Выводит таблицу показателей всех участков текущего потока.
+ */
+void printProfileReport(FILE* stream);
+
+/**
+ * @ingroup ProfilerRoutines
+ * @brief Записывает отчет в файл.
+ * @return 0 в случае успеха, 1 при ошибке открытия или записи файла.
+ */
+int saveProfileReport(const char* path);
+
+#ifdef BRICKGAME_PROFILE
+/**
+ * @def PROFILE_BEGIN
+ * @brief Начинает замер участка в текущем блоке.
+ */
+#define PROFILE_BEGIN(zone) int64_t profileStart_##zone = getMonotonicTime()
+
+/**
+ * @def PROFILE_END
+ * @brief Завершает замер участка, начатый PROFILE_BEGIN().
+ */
+#define PROFILE_END(zone) \
+  recordProfileSample((zone), getMonotonicTime() - profileStart_##zone)
+#else
+#define PROFILE_BEGIN(zone) ((void)0)
+#define PROFILE_END(zone) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+
+namespace s21 {
+
+/**
+ * @brief Замер участка на время жизни объекта (RAII).
+ */
+class ProfileScope {
+ public:
+  explicit ProfileScope(ProfileZone zone)
+      : zone(zone), start(getMonotonicTime()) {}
+  ~ProfileScope() { recordProfileSample(zone, getMonotonicTime() - start); }
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+ private:
+  ProfileZone zone;
+  int64_t start;
+};
+
+}  // namespace s21
+
+#ifdef BRICKGAME_PROFILE
+/**
+ * @def PROFILE_SCOPE
+ * @brief Замер участка до конца текущего блока (C++).
+ */
+#define PROFILE_SCOPE(zone) s21::ProfileScope profileScope_##zone(zone)
+#else
+#define PROFILE_SCOPE(zone) ((void)0)
+#endif
+#endif
+
+#endif
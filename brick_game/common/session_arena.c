@@ -0,0 +1,142 @@
+/**
+ * @file session_arena.c
+ * @brief Реализация арены памяти игровой сессии.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Все функции не потокобезопасны. Используйте одну арену на поток.
+ */
+
+#include "session_arena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "addr_locator.h"
+
+/**
+ * @struct ArenaBlock_t
+ * @brief Заголовок свободного большого объекта (в памяти самого объекта).
+ */
+typedef struct ArenaBlock_t {
+  struct ArenaBlock_t* next;  ///< Следующий свободный объект
+  size_t size;                ///< Выровненный размер объекта
+} ArenaBlock_t;
+
+_Static_assert(sizeof(ArenaBlock_t) <= ARENA_MAX_RECYCLED_SIZE,
+               "large blocks must hold the free list header");
+
+static size_t alignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static int sizeClass(size_t size) {
+  return (int)(alignUp(size, ARENA_ALIGNMENT) / ARENA_ALIGNMENT) - 1;
+}
+
+SessionArena_t* createSessionArena(size_t capacity) {
+  SessionArena_t* arena = NULL;
+  size_t header = alignUp(sizeof(SessionArena_t), ARENA_ALIGNMENT);
+
+  if (capacity > 0 && (arena = malloc(header + capacity)) != NULL) {
+    arena->base = (unsigned char*)arena + header;
+    arena->capacity = capacity;
+    resetSessionArena(arena);
+    locateSessionArena(arena);
+  }
+
+  return arena;
+}
+
+void destroySessionArena(SessionArena_t* arena) {
+  if (arena) {
+    if (arena == locateSessionArena(NULL)) {
+      locateSessionArena(arena);
+    }
+    free(arena);
+  }
+}
+
+void resetSessionArena(SessionArena_t* arena) {
+  if (!arena) return;
+
+  arena->offset = 0;
+  arena->released = NULL;
+  for (int i = 0; i < ARENA_SIZE_CLASSES; i++) {
+    arena->recycled[i] = NULL;
+  }
+}
+
+void* arenaAllocAligned(SessionArena_t* arena, size_t size, size_t alignment) {
+  if (!arena || size == 0 || alignment == 0 ||
+      (alignment & (alignment - 1)) != 0)
+    return NULL;
+
+  uintptr_t base = (uintptr_t)arena->base;
+  size_t start = alignUp(base + arena->offset, alignment) - base;
+  if (start > arena->capacity || size > arena->capacity - start) return NULL;
+
+  arena->offset = start + size;
+  return arena->base + start;
+}
+
+void* arenaAlloc(SessionArena_t* arena, size_t size) {
+  if (!arena || size == 0) return NULL;
+
+  if (size <= ARENA_MAX_RECYCLED_SIZE) {
+    int index = sizeClass(size);
+    void* item = arena->recycled[index];
+    if (item) {
+      arena->recycled[index] = *(void**)item;
+      return item;
+    }
+  }
+
+  size = alignUp(size, ARENA_ALIGNMENT);
+  if (size > ARENA_MAX_RECYCLED_SIZE) {
+    ArenaBlock_t* previous = NULL;
+    for (ArenaBlock_t* block = arena->released; block; block = block->next) {
+      if (block->size == size) {
+        if (previous) {
+          previous->next = block->next;
+        } else {
+          arena->released = block->next;
+        }
+        return block;
+      }
+      previous = block;
+    }
+  }
+
+  return arenaAllocAligned(arena, size, ARENA_ALIGNMENT);
+}
+
+void arenaRelease(SessionArena_t* arena, void* ptr, size_t size) {
+  if (!arena || !ptr || size == 0) return;
+
+  if (size <= ARENA_MAX_RECYCLED_SIZE) {
+    int index = sizeClass(size);
+    *(void**)ptr = arena->recycled[index];
+    arena->recycled[index] = ptr;
+    return;
+  }
+
+  size = alignUp(size, ARENA_ALIGNMENT);
+  unsigned char* bytes = ptr;
+  if (bytes + size == arena->base + arena->offset) {
+    arena->offset = (size_t)(bytes - arena->base);
+    return;
+  }
+
+  ArenaBlock_t* block = ptr;
+  block->size = size;
+  block->next = arena->released;
+  arena->released = block;
+}
+
+SessionArena_t* locateSessionArena(SessionArena_t* arena) {
+  static AddressLocator_t locator = {NULL, false};
+  AddressLocator_t* current = resolveLocator(&locator, LOCATOR_SESSION_ARENA);
+  return (SessionArena_t*)updateLocator(current, arena);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file session_arena.h
+ * @brief Арена памяти игровой сессии BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует арену памяти: одна область памяти выделяется
+ * при старте сессии и раздается структурам модели (поле, матрицы, очередь
+ * блоков, игровые блоки). Освобождение всей памяти сессии выполняется одним
+ * вызовом destroySessionArena().
+ *
+ * Небольшие объекты (не более ARENA_MAX_RECYCLED_SIZE байт), возвращенные
+ * функцией arenaRelease(), повторно используются через списки свободных
+ * объектов по классам размеров. Благодаря этому создание и удаление игровых
+ * блоков во время игры не обращается к системному распределителю памяти.
+ *
+ * Большие объекты (матрицы, буферы очереди блоков) возвращаются в арену
+ * целиком: последний выделенный объект — сдвигом границы свободной памяти
+ * назад, остальные — в список свободных объектов, из которого выделяется
+ * объект точно такого же размера. Поэтому повторяющиеся создание и удаление
+ * объекта одного размера не исчерпывают арену.
+ *
+ * @warning Все функции не потокобезопасны. Используйте одну арену на поток.
+ */
+
+#ifndef SESSION_ARENA_H
+#define SESSION_ARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def SESSION_ARENA_SIZE
+ * @brief Размер арены игровой сессии по умолчанию (в байтах)
+ * @details Значение с запасом покрывает поле, матрицы представления и очередь
+ * блоков змейки, занимающей все поле.
+ */
+#define SESSION_ARENA_SIZE (64 * 1024)
+
+/**
+ * @def ARENA_ALIGNMENT
+ * @brief Выравнивание объектов, выделяемых функцией arenaAlloc()
+ */
+#define ARENA_ALIGNMENT 16
+
+/**
+ * @def ARENA_CACHE_LINE
+ * @brief Размер кэш-линии для arenaAllocAligned() (поле, данные моделей)
+ */
+#define ARENA_CACHE_LINE 64
+
+/**
+ * @def ARENA_MAX_RECYCLED_SIZE
+ * @brief Максимальный размер объекта, повторно используемого ареной
+ */
+#define ARENA_MAX_RECYCLED_SIZE 256
+
+/**
+ * @def ARENA_SIZE_CLASSES
+ * @brief Количество классов размеров списков свободных объектов
+ */
+#define ARENA_SIZE_CLASSES (ARENA_MAX_RECYCLED_SIZE / ARENA_ALIGNMENT)
+
+/**
+ * @struct SessionArena_t
+ * @brief Структура арены памяти игровой сессии
+ * @details Заголовок арены и ее буфер размещаются в одной области памяти.
+ */
+typedef struct SessionArena_t {
+  unsigned char* base;  ///< Начало буфера арены
+  size_t capacity;      ///< Размер буфера арены
+  size_t offset;        ///< Смещение первого свободного байта буфера
+  void* recycled[ARENA_SIZE_CLASSES];  ///< Списки свободных объектов по
+                                       ///< классам размеров
+  void* released;  ///< Список свободных больших объектов
+} SessionArena_t;
+
+/**
+ * @defgroup ArenaRoutines Функции арены памяти
+ * @brief Функции создания арены и выделения памяти из нее
+ */
+
+/**
+ * @ingroup ArenaRoutines
+ * @brief Создает арену заданного размера одним выделением памяти.
+ * @param capacity Размер буфера арены в байтах.
+ * @return Указатель на арену или NULL в случае ошибки выделения памяти.
+ * @details Адрес созданной арены сохраняется в локаторе (locateSessionArena),
+ * если локатор не занят.
+ */
+SessionArena_t* createSessionArena(size_t capacity);
+
+/**
+ * @ingroup ArenaRoutines
+ * @brief Освобождает арену и всю выделенную из нее память.
+ * @param arena Указатель на арену. Если `NULL`, функция ничего не делает.
+ */
+void destroySessionArena(SessionArena_t* arena);
+
+/**
+ * @ingroup ArenaRoutines
+ * @brief Возвращает арену в исходное состояние без освобождения буфера.
+ * @warning Все указатели, ранее полученные из арены, становятся
+ * недействительными.
+ */
+void resetSessionArena(SessionArena_t* arena);
+
+/**
+ * @ingroup ArenaRoutines
+ * @brief Выделяет из арены память, выровненную по ARENA_ALIGNMENT.
+ * @param arena Указатель на арену.
+ * @param size Размер объекта в байтах.
+ * @return Указатель на выделенную память или NULL, если арена исчерпана.
+ */
+void* arenaAlloc(SessionArena_t* arena, size_t size);
+
+/**
+ * @ingroup ArenaRoutines
+ * @brief Выделяет из арены память с заданным выравниванием.
+ * @param alignment Выравнивание (степень двойки).
+ * @details Память, выделенная с выравниванием больше ARENA_ALIGNMENT, не
+ * используется повторно и возвращается только при уничтожении арены.
+ */
+void* arenaAllocAligned(SessionArena_t* arena, size_t size, size_t alignment);
+
+/**
+ * @ingroup ArenaRoutines
+ * @brief Возвращает объект в арену для повторного использования.
+ * @param ptr Указатель, полученный функцией arenaAlloc().
+ * @param size Размер, с которым объект был выделен.
+ * @details Объект размером более ARENA_MAX_RECYCLED_SIZE повторно
+ * используется при выделении объекта того же размера (после выравнивания по
+ * ARENA_ALIGNMENT), а последний выделенный объект сразу возвращает свою
+ * память арене.
+ */
+void arenaRelease(SessionArena_t* arena, void* ptr, size_t size);
+
+/**
+ * @ingroup AddressProviders
+ * @brief Функция локатор арены текущей игровой сессии.
+ * @param arena Указатель на арену. Если `NULL`, возвращает текущую арену.
+ * @return Текущая арена или `NULL`.
+ * @details Поведение аналогично locateGameInfo().
+ *
+ * @warning Не передавайте адрес вручную — используйте только
+ * `createSessionArena`/`destroySessionArena`.
+ */
+SessionArena_t* locateSessionArena(SessionArena_t* arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
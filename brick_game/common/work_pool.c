@@ -0,0 +1,233 @@
+/**
+ * @file work_pool.c
+ * @brief Реализация пула потоков с перехватом работы.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "work_pool.h"
+
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define POOL_CACHE_LINE 64
+#define RANGE_BITS 32
+
+/**
+ * @struct WorkRange_t
+ * @brief Диапазон номеров задач участника: начало в младших RANGE_BITS
+ * битах, конец — в старших.
+ * @details Диапазоны участников занимают отдельные кэш-линии.
+ */
+typedef struct WorkRange_t {
+  alignas(POOL_CACHE_LINE) _Atomic uint64_t bounds;
+} WorkRange_t;
+
+/**
+ * @struct WorkThread_t
+ * @brief Аргумент потока пула.
+ */
+typedef struct WorkThread_t {
+  WorkPool_t* pool;  ///< Пул
+  int id;            ///< Номер участника (0 — вызывающий поток)
+} WorkThread_t;
+
+struct WorkPool_t {
+  WorkRange_t ranges[WORK_POOL_MAX_THREADS];  ///< Диапазоны участников
+  WorkThread_t workers[WORK_POOL_MAX_THREADS];  ///< Аргументы потоков
+  pthread_t handles[WORK_POOL_MAX_THREADS];     ///< Потоки (с номера 1)
+  int threads;               ///< Количество участников
+  int started;               ///< Количество запущенных потоков
+  pthread_mutex_t mutex;     ///< Защищает поля пакета ниже
+  pthread_cond_t wake;       ///< Новый пакет или остановка
+  pthread_cond_t done;       ///< Поток закончил пакет
+  unsigned long generation;  ///< Номер текущего пакета
+  int finished;              ///< Количество потоков, закончивших пакет
+  bool stop;                 ///< Признак остановки пула
+  WorkTask_t task;           ///< Задача текущего пакета
+  void* context;             ///< Контекст текущего пакета
+};
+
+static uint64_t packRange(uint32_t begin, uint32_t end) {
+  return (uint64_t)end << RANGE_BITS | begin;
+}
+
+static bool takeTask(WorkRange_t* range, int* index) {
+  uint64_t bounds = atomic_load(&range->bounds);
+
+  for (;;) {
+    uint32_t begin = (uint32_t)bounds;
+    uint32_t end = (uint32_t)(bounds >> RANGE_BITS);
+    if (begin >= end) return false;
+    if (atomic_compare_exchange_weak(&range->bounds, &bounds,
+                                     packRange(begin + 1, end))) {
+      *index = (int)begin;
+      return true;
+    }
+  }
+}
+
+/*
+ * Перехватывает вторую половину первого непустого чужого диапазона. Пустой
+ * собственный диапазон изменяют только его владелец и (безуспешно) другие
+ * участники, поэтому перехваченная часть записывается в него без CAS.
+ */
+static bool stealTasks(WorkPool_t* pool, int thief) {
+  for (int k = 1; k < pool->threads; k++) {
+    WorkRange_t* victim = &pool->ranges[(thief + k) % pool->threads];
+    uint64_t bounds = atomic_load(&victim->bounds);
+
+    for (;;) {
+      uint32_t begin = (uint32_t)bounds;
+      uint32_t end = (uint32_t)(bounds >> RANGE_BITS);
+      if (begin >= end) break;
+
+      uint32_t middle = begin + (end - begin) / 2;
+      if (atomic_compare_exchange_weak(&victim->bounds, &bounds,
+                                       packRange(begin, middle))) {
+        atomic_store(&pool->ranges[thief].bounds, packRange(middle, end));
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+static void runTasks(WorkPool_t* pool, int id, WorkTask_t task,
+                     void* context) {
+  int index = 0;
+
+  do {
+    while (takeTask(&pool->ranges[id], &index)) task(context, index);
+  } while (stealTasks(pool, id));
+}
+
+static void* runWorker(void* argument) {
+  WorkThread_t* worker = (WorkThread_t*)argument;
+  WorkPool_t* pool = worker->pool;
+  unsigned long seen = 0;
+
+  pthread_mutex_lock(&pool->mutex);
+  for (;;) {
+    while (!pool->stop && pool->generation == seen)
+      pthread_cond_wait(&pool->wake, &pool->mutex);
+    if (pool->stop) break;
+
+    seen = pool->generation;
+    WorkTask_t task = pool->task;
+    void* context = pool->context;
+    pthread_mutex_unlock(&pool->mutex);
+
+    runTasks(pool, worker->id, task, context);
+
+    pthread_mutex_lock(&pool->mutex);
+    if (++pool->finished == pool->threads - 1)
+      pthread_cond_signal(&pool->done);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  return NULL;
+}
+
+static int availableThreads() {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return cores > 0 ? (int)cores : 1;
+}
+
+WorkPool_t* createWorkPool(int threads) {
+  WorkPool_t* pool = aligned_alloc(POOL_CACHE_LINE, sizeof(WorkPool_t));
+  if (!pool) return NULL;
+
+  memset(pool, 0, sizeof(WorkPool_t));
+  if (threads <= 0) threads = availableThreads();
+  pool->threads =
+      threads < WORK_POOL_MAX_THREADS ? threads : WORK_POOL_MAX_THREADS;
+  for (int i = 0; i < WORK_POOL_MAX_THREADS; i++) {
+    atomic_init(&pool->ranges[i].bounds, 0);
+    pool->workers[i] = (WorkThread_t){pool, i};
+  }
+
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->wake, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  bool created = true;
+  for (int i = 1; i < pool->threads && created; i++) {
+    created = !pthread_create(&pool->handles[i], NULL, runWorker,
+                              &pool->workers[i]);
+    if (created) ++pool->started;
+  }
+
+  if (!created) {
+    destroyWorkPool(pool);
+    pool = NULL;
+  }
+
+  return pool;
+}
+
+void destroyWorkPool(WorkPool_t* pool) {
+  if (!pool) return;
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->stop = true;
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->mutex);
+  for (int i = 1; i <= pool->started; i++) pthread_join(pool->handles[i], NULL);
+
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->wake);
+  pthread_mutex_destroy(&pool->mutex);
+  free(pool);
+}
+
+int getWorkPoolThreads(const WorkPool_t* pool) {
+  return pool ? pool->threads : 0;
+}
+
+int runWorkPool(WorkPool_t* pool, WorkTask_t task, void* context,
+                int count) {
+  if (!pool || !task || count < 0) return 1;
+  if (count == 0) return 0;
+
+  // Начальные диапазоны участников равны.
+  int threads = pool->threads;
+  for (int i = 0; i < threads; i++) {
+    uint32_t begin = (uint32_t)((long long)count * i / threads);
+    uint32_t end = (uint32_t)((long long)count * (i + 1) / threads);
+    atomic_store(&pool->ranges[i].bounds, packRange(begin, end));
+  }
+
+  if (threads > 1) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->task = task;
+    pool->context = context;
+    pool->finished = 0;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+  }
+
+  runTasks(pool, 0, task, context);
+
+  // Пакет завершен, когда все потоки вышли из runTasks(): после этого
+  // диапазоны следующего пакета не видны потокам текущего.
+  if (threads > 1) {
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->finished < threads - 1)
+      pthread_cond_wait(&pool->done, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+  }
+
+  return 0;
+}
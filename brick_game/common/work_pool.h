@@ -0,0 +1,94 @@
+/**
+ * @file work_pool.h
+ * @brief Пул потоков с перехватом работы для BrickGame
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль выполняет пакет независимых задач `task(context, i)`
+ * для `i` от 0 до `count - 1` в постоянном пуле потоков. Потоки создаются
+ * один раз при создании пула и между пакетами ожидают на условной
+ * переменной, поэтому запуск пакета не создает потоков и не выделяет
+ * память.
+ *
+ * Номера задач пакета делятся на непрерывные диапазоны по одному на
+ * участника (потоки пула и вызывающий поток). Участник берет задачи из
+ * начала своего диапазона, а опустошив его, перехватывает (work stealing)
+ * половину конца чужого диапазона. Диапазон хранится одним атомарным
+ * 64-битным словом (начало и конец), поэтому взятие и перехват задач — одна
+ * операция сравнения с обменом (CAS) без блокировок. Перехват выравнивает
+ * нагрузку, если задачи пакета неравны по длительности.
+ *
+ * Пакет завершается, когда все участники закончили работу, поэтому после
+ * возврата из runWorkPool() задачи пакета не выполняются и контекст пакета
+ * можно освобождать.
+ */
+
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def WORK_POOL_MAX_THREADS
+ * @brief Максимальное количество участников пакета (включая вызывающий
+ * поток)
+ */
+#define WORK_POOL_MAX_THREADS 64
+
+/**
+ * @brief Задача пакета.
+ * @param context Контекст пакета.
+ * @param index Номер задачи в пакете.
+ */
+typedef void (*WorkTask_t)(void* context, int index);
+
+/**
+ * @struct WorkPool_t
+ * @brief Пул потоков (структура скрыта в реализации).
+ */
+typedef struct WorkPool_t WorkPool_t;
+
+/**
+ * @defgroup WorkPoolRoutines Функции пула потоков
+ * @brief Функции создания пула и выполнения пакетов задач
+ */
+
+/**
+ * @ingroup WorkPoolRoutines
+ * @brief Создает пул потоков.
+ * @param threads Количество участников пакета, включая вызывающий поток
+ * (0 — по количеству ядер процессора). Значение ограничивается
+ * WORK_POOL_MAX_THREADS; при значении 1 задачи выполняет вызывающий поток.
+ * @return Указатель на пул или NULL при ошибке создания.
+ */
+WorkPool_t* createWorkPool(int threads);
+
+/**
+ * @ingroup WorkPoolRoutines
+ * @brief Останавливает потоки и освобождает пул.
+ */
+void destroyWorkPool(WorkPool_t* pool);
+
+/**
+ * @ingroup WorkPoolRoutines
+ * @brief Возвращает количество участников пакета.
+ */
+int getWorkPoolThreads(const WorkPool_t* pool);
+
+/**
+ * @ingroup WorkPoolRoutines
+ * @brief Выполняет пакет задач и ожидает его завершения.
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ * @details Вызывающий поток участвует в выполнении пакета. Пакеты одного
+ * пула выполняются по одному: функция не реентерабельна.
+ */
+int runWorkPool(WorkPool_t* pool, WorkTask_t task, void* context, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
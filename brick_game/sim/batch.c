@@ -0,0 +1,97 @@
+/**
+ * @file batch.c
+ * @brief Реализация пакетной симуляции.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "batch.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * @struct SimWorker_t
+ * @brief Задание и результаты одного потока пакетной симуляции.
+ * @details Поток пишет в структуру только после завершения всех своих игр,
+ * поэтому соседние структуры массива не разделяют кэш-линию во время работы.
+ */
+typedef struct SimWorker_t {
+  const SimConfig_t* config;  ///< Параметры игры
+  unsigned long first;        ///< Номер первой игры диапазона
+  unsigned long count;        ///< Количество игр диапазона
+  SimReport_t report;         ///< Результаты диапазона
+  int error;                  ///< Признак ошибки создания контекста
+} SimWorker_t;
+
+static void* runWorker(void* argument) {
+  SimWorker_t* worker = (SimWorker_t*)argument;
+  SimConfig_t game = *worker->config;
+  SimReport_t total = {0};
+  SimReport_t part;
+  GameContext_t* context = createGameContext(game.seed);
+
+  if (!context) {
+    worker->error = 1;
+    return NULL;
+  }
+
+  game.maxGames = 1;
+  for (unsigned long i = 0; i < worker->count; i++) {
+    game.seed = worker->config->seed + worker->first + i;
+    simulateInContext(context, &game, &part);
+    mergeSimReport(&total, &part);
+  }
+  destroyGameContext(context);
+
+  worker->report = total;
+  return NULL;
+}
+
+int availableCores() {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return cores > 0 ? (int)cores : 1;
+}
+
+int runSimulationBatch(const SimConfig_t* config, int threads,
+                       SimReport_t* report) {
+  if (!isValidSimConfig(config) || !config->maxGames || !report ||
+      threads < 1 || threads > SIM_MAX_THREADS)
+    return 1;
+
+  SimWorker_t workers[SIM_MAX_THREADS] = {0};
+  pthread_t handles[SIM_MAX_THREADS];
+  unsigned long games = config->maxGames;
+  unsigned long first = 0;
+  int started = 0;
+  int error = 0;
+  struct timespec start;
+
+  if ((unsigned long)threads > games) threads = (int)games;
+  *report = (SimReport_t){0};
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for (int i = 0; i < threads && !error; i++) {
+    workers[i].config = config;
+    workers[i].first = first;
+    workers[i].count = games / threads + ((unsigned long)i < games % threads);
+    first += workers[i].count;
+    if (pthread_create(&handles[i], NULL, runWorker, &workers[i]))
+      error = 1;
+    else
+      ++started;
+  }
+
+  for (int i = 0; i < started; i++) {
+    pthread_join(handles[i], NULL);
+    error |= workers[i].error;
+    mergeSimReport(report, &workers[i].report);
+  }
+  report->seconds = elapsedSeconds(&start);
+
+  return error;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file batch.h
+ * @brief Пакетная симуляция BrickGame на всех ядрах процессора
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль запускает большое количество независимых игр в пуле
+ * потоков. Каждый поток владеет собственным контекстом игры (GameContext_t)
+ * и обрабатывает непрерывный диапазон номеров игр; результаты потока
+ * накапливаются локально и объединяются после завершения всех потоков.
+ * Общего изменяемого состояния у потоков нет, поэтому производительность
+ * растет линейно с количеством ядер.
+ *
+ * Игра с номером `n` использует начальное значение `seed + n`, поэтому
+ * результаты пакета не зависят от количества потоков.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "headless.h"
+
+/**
+ * @def SIM_MAX_THREADS
+ * @brief Максимальное количество потоков пакетной симуляции
+ */
+#define SIM_MAX_THREADS 256
+
+/**
+ * @brief Возвращает количество доступных ядер процессора (не менее 1).
+ */
+int availableCores();
+
+/**
+ * @brief Выполняет пакетную симуляцию.
+ * @param config Параметры одной игры: `seed` — начальное значение пакета,
+ * `maxTicks` — ограничение тактов одной игры (0 — без ограничения),
+ * `maxGames` — количество игр в пакете (больше 0).
+ * @param threads Количество потоков (от 1 до SIM_MAX_THREADS).
+ * @param report Сводные результаты пакета.
+ * @return 0 в случае успеха, 1 при ошибке параметров, создания потоков или
+ * контекстов игры.
+ */
+int runSimulationBatch(const SimConfig_t* config, int threads,
+                       SimReport_t* report);
+
+#endif
@@ -0,0 +1,217 @@
+/**
+ * @file field_bench.c
+ * @brief Реализация проверки и замера удаления заполненных строк.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "field_bench.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../common/field_simd.h"
+#include "../common/game_rng.h"
+#include "headless.h"
+
+/**
+ * @def FIELD_BENCH_FULL_RATE
+ * @brief Доля заполненных строк поля (1 из FIELD_BENCH_FULL_RATE)
+ */
+#define FIELD_BENCH_FULL_RATE 8
+
+/**
+ * @def FIELD_BENCH_SWEEP
+ * @brief Наибольшая высота поля при проверке остатков векторного прохода
+ */
+#define FIELD_BENCH_SWEEP (3 * FIELD_MASK_BITS)
+
+/**
+ * @struct FieldBoard_t
+ * @brief Поле произвольной высоты: маски строк, цвета и маска удаления.
+ */
+typedef struct FieldBoard_t {
+  int height;          ///< Высота поля
+  FieldRow_t* rows;    ///< Маски строк
+  uint8_t* colors;     ///< Цвета клеток (FIELD_WIDTH на строку)
+  uint32_t* mask;      ///< Маска заполненных строк
+} FieldBoard_t;
+
+static void destroyBoard(FieldBoard_t* board) {
+  free(board->rows);
+  free(board->colors);
+  free(board->mask);
+}
+
+static bool createBoard(FieldBoard_t* board, int height) {
+  board->height = height;
+  board->rows = malloc((size_t)height * sizeof(FieldRow_t));
+  board->colors = malloc((size_t)height * FIELD_WIDTH);
+  board->mask = malloc(FIELD_MASK_WORDS(height) * sizeof(uint32_t));
+  if (board->rows && board->colors && board->mask) return true;
+
+  destroyBoard(board);
+  return false;
+}
+
+static void copyBoard(FieldBoard_t* target, const FieldBoard_t* source) {
+  memcpy(target->rows, source->rows,
+         (size_t)source->height * sizeof(FieldRow_t));
+  memcpy(target->colors, source->colors, (size_t)source->height * FIELD_WIDTH);
+}
+
+static bool isSameBoard(const FieldBoard_t* a, const FieldBoard_t* b) {
+  return !memcmp(a->rows, b->rows, (size_t)a->height * sizeof(FieldRow_t)) &&
+         !memcmp(a->colors, b->colors, (size_t)a->height * FIELD_WIDTH);
+}
+
+static void fillBoard(FieldBoard_t* board, uint64_t seed) {
+  FieldRow_t emptyRow = makeEmptyFieldRow(FIELD_WIDTH);
+  GameRng_t rng;
+
+  seedGameRng(&rng, seed);
+  for (int i = 0; i < board->height; i++) {
+    FieldRow_t row = FIELD_FULL_ROW;
+    if (nextGameRng(&rng) % FIELD_BENCH_FULL_RATE) {
+      // Незаполненная строка: хотя бы одна клетка свободна.
+      int hole = (int)(nextGameRng(&rng) % FIELD_WIDTH);
+      row = (FieldRow_t)(emptyRow | nextGameRng(&rng));
+      row &= (FieldRow_t)~(1u << (hole + FIELD_WALL_OFFSET));
+    }
+    board->rows[i] = row;
+    for (int j = 0; j < FIELD_WIDTH; j++)
+      board->colors[i * FIELD_WIDTH + j] =
+          (uint8_t)(1 + nextGameRng(&rng) % 7);
+  }
+}
+
+// Повторяет clearFullFieldRows() для поля произвольной высоты.
+static int clearBoardRows(FieldBoard_t* board) {
+  FieldRow_t emptyRow = makeEmptyFieldRow(FIELD_WIDTH);
+
+  if (!findFullRows(board->rows, board->height, FIELD_FULL_ROW, board->mask))
+    return 0;
+
+  int cleared = compactRows(board->rows, sizeof(FieldRow_t), board->height,
+                            board->mask);
+  compactRows(board->colors, FIELD_WIDTH, board->height, board->mask);
+  for (int i = 0; i < cleared; i++) board->rows[i] = emptyRow;
+  memset(board->colors, 0, (size_t)cleared * FIELD_WIDTH);
+
+  return cleared;
+}
+
+static double benchKernel(FieldBoard_t* work, const FieldBoard_t* source,
+                          unsigned long repeats) {
+  double seconds = 0;
+
+  for (unsigned long i = 0; i < repeats; i++) {
+    struct timespec start;
+    copyBoard(work, source);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    clearBoardRows(work);
+    seconds += elapsedSeconds(&start);
+  }
+
+  return seconds;
+}
+
+static bool isExactKernel(FieldKernel kernel, FieldBoard_t* source,
+                          FieldBoard_t* reference, FieldBoard_t* work) {
+  copyBoard(reference, source);
+  selectFieldKernel(FIELD_KERNEL_SCALAR);
+  clearBoardRows(reference);
+
+  copyBoard(work, source);
+  selectFieldKernel(kernel);
+  clearBoardRows(work);
+
+  return isSameBoard(work, reference);
+}
+
+/**
+ * @brief Создает исходное, эталонное и рабочее поле высотой `height`.
+ * @return true в случае успеха.
+ */
+static bool createBoards(FieldBoard_t* boards, int height) {
+  int created = 0;
+
+  while (created < 3 && createBoard(&boards[created], height)) ++created;
+  for (int i = 0; created < 3 && i < created; i++) destroyBoard(&boards[i]);
+
+  return created == 3;
+}
+
+static void destroyBoards(FieldBoard_t* boards) {
+  for (int i = 0; i < 3; i++) destroyBoard(&boards[i]);
+}
+
+/*
+ * Поля высотой до FIELD_BENCH_SWEEP строк проверяют обработку строк, не
+ * кратных ширине вектора.
+ */
+static bool isExactOnSmallFields(FieldKernel kernel, uint64_t seed) {
+  FieldBoard_t boards[3];
+  if (!createBoards(boards, FIELD_BENCH_SWEEP)) return false;
+
+  bool exact = true;
+  for (int height = 1; height <= FIELD_BENCH_SWEEP && exact; height++) {
+    for (int i = 0; i < 3; i++) boards[i].height = height;
+    fillBoard(&boards[0], seed + (uint64_t)height);
+    exact = isExactKernel(kernel, &boards[0], &boards[1], &boards[2]);
+  }
+  destroyBoards(boards);
+
+  return exact;
+}
+
+int runFieldBench(int rows, uint64_t seed, FILE* stream) {
+  FieldBoard_t boards[3];
+  FieldBoard_t* source = &boards[0];
+  FieldBoard_t* reference = &boards[1];
+  FieldBoard_t* work = &boards[2];
+  if (rows <= 0 || !createBoards(boards, rows)) return 1;
+
+  FieldKernel selected = getFieldKernel();
+  unsigned long repeats = FIELD_BENCH_ROWS / (unsigned long)rows;
+  if (repeats == 0) repeats = 1;
+  double scalarSeconds = 0;
+  int error = 0;
+
+  fillBoard(source, seed);
+  copyBoard(work, source);
+  selectFieldKernel(FIELD_KERNEL_SCALAR);
+  int cleared = clearBoardRows(work);
+  fprintf(stream, "rows:    %d (%d full), %lu repeats\n", rows, cleared,
+          repeats);
+
+  for (int kernel = 0; kernel < NUM_FIELD_KERNELS; kernel++) {
+    if (selectFieldKernel((FieldKernel)kernel)) {
+      fprintf(stream, "%-8s unsupported\n", fieldKernelName(kernel));
+      continue;
+    }
+
+    bool exact = isExactKernel((FieldKernel)kernel, source, reference,
+                               work) &&
+                 isExactOnSmallFields((FieldKernel)kernel, seed);
+    double seconds = benchKernel(work, source, repeats);
+    if (kernel == FIELD_KERNEL_SCALAR) scalarSeconds = seconds;
+    if (!exact) error = 1;
+
+    fprintf(stream, "%-8s %.3f ns/row, x%.2f, %s\n",
+            fieldKernelName(kernel),
+            seconds * 1e9 / ((double)repeats * rows),
+            seconds > 0 ? scalarSeconds / seconds : 0.0,
+            exact ? "bit-exact" : "MISMATCH");
+  }
+
+  selectFieldKernel(selected);
+  destroyBoards(boards);
+
+  return error;
+}
@@ -0,0 +1,46 @@
+/**
+ * @file field_bench.h
+ * @brief Проверка и замер реализаций удаления заполненных строк
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль сравнивает реализации удаления заполненных строк
+ * (field_simd.h) на поле произвольной высоты: маски строк и плоскость
+ * цветов заполняются случайными строками с заданным начальным значением,
+ * примерно каждая восьмая строка заполнена. Для каждой поддерживаемой
+ * процессором реализации:
+ *          - результат (маски строк и цвета) побитово сравнивается с
+ *            результатом скалярной реализации;
+ *          - измеряется время удаления строк одного поля (поиск,
+ *            уплотнение масок и цветов, очистка верхних строк) в
+ *            наносекундах на строку.
+ *
+ * Высота поля модели (FIELD_HEIGHT) слишком мала для замера, поэтому
+ * разница реализаций видна на полях из тысяч строк.
+ */
+
+#ifndef FIELD_BENCH_H
+#define FIELD_BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @def FIELD_BENCH_ROWS
+ * @brief Суммарное количество строк, обрабатываемых одной реализацией
+ */
+#define FIELD_BENCH_ROWS (1ul << 26)
+
+/**
+ * @brief Сравнивает реализации удаления строк на поле высотой `rows`.
+ * @param rows Высота поля (больше 0).
+ * @param seed Начальное значение генератора содержимого поля.
+ * @param stream Поток вывода отчета.
+ * @return 0 в случае успеха, 1 при ошибке выделения памяти или если
+ * результат какой-либо реализации отличается от скалярного.
+ * @details Выбранная до вызова реализация восстанавливается.
+ */
+int runFieldBench(int rows, uint64_t seed, FILE* stream);
+
+#endif
@@ -0,0 +1,227 @@
+/**
+ * @file headless.c
+ * @brief Реализация режима headless-симуляции.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Каждый прогон работает с собственным контекстом игры
+ * (GameContext_t), поэтому прогоны можно выполнять в разных потоках
+ * одновременно. Один контекст одновременно используется только одним
+ * потоком (см. simulateInContext()).
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "headless.h"
+
+#include <string.h>
+#include <time.h>
+
+/**
+ * @def SIM_POLICY_SALT
+ * @brief Смещение начального значения генератора политики ввода
+ * @details Генераторы модели и ввода инициализируются разными значениями,
+ * чтобы последовательности фигур и действий не совпадали.
+ */
+#define SIM_POLICY_SALT 0x5DEECE66Dull
+
+/**
+ * @def SIM_NO_ACTION
+ * @brief Признак такта без действия пользователя
+ */
+#define SIM_NO_ACTION (-1)
+
+/**
+ * @struct SimInput_t
+ * @brief Состояние политики ввода прогона.
+ */
+typedef struct SimInput_t {
+  GameRng_t rng;        ///< Генератор случайных действий
+  size_t scriptLength;  ///< Длина сценария (вычисляется при начале прогона)
+} SimInput_t;
+
+static const UserAction_t randomActions[] = {Left, Right, Up, Down, Action};
+
+double elapsedSeconds(const struct timespec* start) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)(now.tv_sec - start->tv_sec) +
+         (double)(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int scriptAction(char symbol) {
+  switch (symbol) {
+    case 'L':
+      return Left;
+    case 'R':
+      return Right;
+    case 'U':
+      return Up;
+    case 'D':
+      return Down;
+    case 'A':
+      return Action;
+    case 'P':
+      return Pause;
+    case 'S':
+      return Start;
+    default:
+      return SIM_NO_ACTION;
+  }
+}
+
+static int nextAction(const SimConfig_t* config, SimInput_t* input,
+                      unsigned long tick) {
+  if (config->policy == SIM_POLICY_AUTOPLAY) return SIM_NO_ACTION;
+  if (config->policy == SIM_POLICY_SCRIPT) {
+    if (!input->scriptLength) return SIM_NO_ACTION;
+    return scriptAction(config->script[tick % input->scriptLength]);
+  }
+
+  if (nextGameRng(&input->rng) % 100 >= (uint32_t)config->actionPercent)
+    return SIM_NO_ACTION;
+
+  return randomActions[nextGameRng(&input->rng) %
+                       FSM_ARRAY_SIZE(randomActions)];
+}
+
+static bool isRunFinished(const SimConfig_t* config,
+                          const SimReport_t* report) {
+  return (config->maxTicks && report->ticks >= config->maxTicks) ||
+         (config->maxGames && report->games >= config->maxGames);
+}
+
+void simulateInContext(GameContext_t* context, const SimConfig_t* config,
+                       SimReport_t* report) {
+  GameCounters_t initial = context->counters;
+  SimInput_t input;
+  Autoplayer_t* player = config->policy == SIM_POLICY_AUTOPLAY
+                             ? createAutoplayer(config->autoplayThreads)
+                             : NULL;
+
+  *report = (SimReport_t){0};
+  seedGameRng(&input.rng, config->seed ^ SIM_POLICY_SALT);
+  input.scriptLength =
+      config->policy == SIM_POLICY_SCRIPT ? strlen(config->script) : 0;
+  restartGameContext(context, config->seed);
+
+  contextUserInput(context, Start, false);
+  while (!isRunFinished(config, report)) {
+    int action = nextAction(config, &input, report->ticks);
+    if (player) report->actions += contextAutoplayMove(context, player);
+    if (action != SIM_NO_ACTION) {
+      contextUserInput(context, (UserAction_t)action, false);
+      ++report->actions;
+    }
+    contextUpdate(context);
+    ++report->ticks;
+
+    if (context->info->score > report->bestScore)
+      report->bestScore = context->info->score;
+    report->games = context->counters.games - initial.games;
+    if (context->fsm->currentState == STATE_GAME_OVER &&
+        !isRunFinished(config, report))
+      contextUserInput(context, Start, false);
+  }
+
+  report->pieces = context->counters.pieces - initial.pieces;
+  report->lines = context->counters.lines - initial.lines;
+  destroyAutoplayer(player);
+}
+
+void mergeSimReport(SimReport_t* total, const SimReport_t* part) {
+  total->ticks += part->ticks;
+  total->actions += part->actions;
+  total->pieces += part->pieces;
+  total->lines += part->lines;
+  total->games += part->games;
+  if (part->bestScore > total->bestScore) total->bestScore = part->bestScore;
+}
+
+bool isValidSimConfig(const SimConfig_t* config) {
+  return config && (config->maxTicks || config->maxGames) &&
+         config->actionPercent >= 0 && config->actionPercent <= 100 &&
+         (config->policy != SIM_POLICY_SCRIPT || config->script) &&
+         config->autoplayThreads >= 0;
+}
+
+void initSimConfig(SimConfig_t* config) {
+  config->seed = 0;
+  config->policy = SIM_POLICY_RANDOM;
+  config->script = NULL;
+  config->actionPercent = 20;
+  config->maxTicks = 0;
+  config->maxGames = 100;
+  config->autoplayThreads = 1;
+}
+
+int runSimulation(const SimConfig_t* config, SimReport_t* report) {
+  if (!isValidSimConfig(config) || !report) return 1;
+
+  GameContext_t* context = createGameContext(config->seed);
+  if (!context) return 1;
+
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  simulateInContext(context, config, report);
+  report->seconds = elapsedSeconds(&start);
+  destroyGameContext(context);
+
+  return 0;
+}
+
+int runReplay(const char* path, SimReport_t* report) {
+  uint64_t seed = 0;
+  InputLogReader_t* reader = report ? openInputLog(path, &seed) : NULL;
+  GameContext_t* context = reader ? createGameContext(seed) : NULL;
+  if (!context) {
+    closeInputLog(reader);
+    return 1;
+  }
+
+  InputLogEvent_t event;
+  InputLogStatus status;
+  struct timespec start;
+
+  *report = (SimReport_t){0};
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  while ((status = readInputLogEvent(reader, &event)) == INPUT_LOG_OK) {
+    if (event.type == INPUT_LOG_TICK) {
+      contextUpdate(context);
+      ++report->ticks;
+    } else {
+      contextUserInput(context, event.action, event.hold);
+      ++report->actions;
+    }
+    if (context->info->score > report->bestScore)
+      report->bestScore = context->info->score;
+  }
+  report->seconds = elapsedSeconds(&start);
+  report->pieces = context->counters.pieces;
+  report->lines = context->counters.lines;
+  report->games = context->counters.games;
+
+  destroyGameContext(context);
+  closeInputLog(reader);
+
+  return status == INPUT_LOG_END ? 0 : 1;
+}
+
+static double perSecond(unsigned long count, double seconds) {
+  return seconds > 0 ? (double)count / seconds : 0.0;
+}
+
+void printSimReport(FILE* stream, const SimReport_t* report) {
+  fprintf(stream, "ticks:   %lu (%.0f ticks/s)\n", report->ticks,
+          perSecond(report->ticks, report->seconds));
+  fprintf(stream, "pieces:  %lu (%.0f pieces/s)\n", report->pieces,
+          perSecond(report->pieces, report->seconds));
+  fprintf(stream, "games:   %lu (%.1f games/s)\n", report->games,
+          perSecond(report->games, report->seconds));
+  fprintf(stream, "lines:   %lu\n", report->lines);
+  fprintf(stream, "actions: %lu\n", report->actions);
+  fprintf(stream, "best:    %d\n", report->bestScore);
+  fprintf(stream, "time:    %.3f s\n", report->seconds);
+}
@@ -0,0 +1,144 @@
+/**
+ * @file headless.h
+ * @brief Режим headless-симуляции модели BrickGame (Tetris, Snake)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль управляет моделью игры без представления и без
+ * задержек между тактами: каждый такт — одно действие политики ввода
+ * (userInput) и один вызов fsm_update(). Действия выбираются сценарием или
+ * случайной политикой с заданным начальным значением, поэтому прогон
+ * воспроизводим. По результатам прогона формируется отчет о
+ * производительности модели (такты, фигуры и игры в секунду).
+ *
+ * Каждый прогон использует собственный контекст игры (GameContext_t), поэтому
+ * прогоны в разных потоках независимы (см. batch.h).
+ *
+ * Запись сессии (input_log.h) воспроизводится без задержек между событиями
+ * (runReplay()): результат воспроизведения совпадает с записанной игрой, а
+ * время воспроизведения измеряет производительность модели на реальном
+ * вводе.
+ *
+ * Модуль не зависит от конкретной игры: игра определяется библиотекой модели
+ * (tetris.a, snake.a), с которой собирается симулятор.
+ */
+
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../common/game_context.h"
+#include "../common/input_log.h"
+
+/**
+ * @enum SimPolicyType
+ * @brief Политика выбора действий пользователя.
+ */
+typedef enum {
+  SIM_POLICY_RANDOM,  ///< Случайные действия с заданной вероятностью
+  SIM_POLICY_SCRIPT,  ///< Циклически повторяемый сценарий действий
+  SIM_POLICY_AUTOPLAY  ///< Автоматический игрок (autoplayer.h)
+} SimPolicyType;
+
+/**
+ * @struct SimConfig_t
+ * @brief Параметры прогона симуляции.
+ * @details Прогон завершается по достижении `maxTicks` тактов или `maxGames`
+ * завершенных игр (значение 0 снимает ограничение). Хотя бы одно
+ * ограничение должно быть задано.
+ *
+ * Сценарий — строка, каждый символ которой задает действие одного такта:
+ * `L` — Left, `R` — Right, `U` — Up, `D` — Down, `A` — Action, `P` — Pause,
+ * `S` — Start, `.` — нет действия.
+ *
+ * Автоматический игрок создается на время прогона с `autoplayThreads`
+ * потоками поиска хода. Если игра не поддерживает автоматического игрока,
+ * прогон выполняется без действий.
+ */
+typedef struct SimConfig_t {
+  uint64_t seed;           ///< Начальное значение генераторов модели и ввода
+  SimPolicyType policy;    ///< Политика выбора действий
+  const char* script;      ///< Сценарий (для SIM_POLICY_SCRIPT)
+  int actionPercent;       ///< Вероятность действия в такте, % (0..100)
+  unsigned long maxTicks;  ///< Ограничение количества тактов
+  unsigned long maxGames;  ///< Ограничение количества игр
+  int autoplayThreads;     ///< Потоки поиска (для SIM_POLICY_AUTOPLAY)
+} SimConfig_t;
+
+/**
+ * @struct SimReport_t
+ * @brief Результаты прогона симуляции.
+ */
+typedef struct SimReport_t {
+  unsigned long ticks;    ///< Количество тактов (вызовов fsm_update)
+  unsigned long actions;  ///< Количество действий пользователя
+  unsigned long pieces;   ///< Количество фигур (съеденной еды)
+  unsigned long lines;    ///< Количество удаленных строк
+  unsigned long games;    ///< Количество завершенных игр
+  int bestScore;          ///< Лучший результат за прогон
+  double seconds;         ///< Время прогона, с
+} SimReport_t;
+
+/**
+ * @brief Инициализирует параметры прогона значениями по умолчанию.
+ * @details Случайная политика, 20% тактов с действием, 100 игр.
+ */
+void initSimConfig(SimConfig_t* config);
+
+/**
+ * @brief Выполняет прогон симуляции.
+ * @param config Параметры прогона.
+ * @param report Результаты прогона.
+ * @return 0 в случае успеха, 1 при ошибке параметров или создания ресурсов.
+ * @details Создает контекст игры, выполняет прогон и уничтожает контекст.
+ */
+int runSimulation(const SimConfig_t* config, SimReport_t* report);
+
+/**
+ * @brief Проверяет параметры прогона.
+ * @return true, если параметры допустимы.
+ */
+bool isValidSimConfig(const SimConfig_t* config);
+
+/**
+ * @brief Выполняет прогон в существующем контексте игры.
+ * @param context Контекст игры. Перед прогоном возвращается в начальное
+ * состояние с начальным значением `config->seed`.
+ * @param config Параметры прогона (допустимость не проверяется).
+ * @param report Результаты прогона (время прогона не измеряется).
+ */
+void simulateInContext(GameContext_t* context, const SimConfig_t* config,
+                       SimReport_t* report);
+
+/**
+ * @brief Воспроизводит запись сессии с максимальной скоростью.
+ * @param path Путь к файлу записи.
+ * @param report Результаты воспроизведения.
+ * @return 0 в случае успеха, 1 при ошибке открытия, поврежденной записи или
+ * ошибке создания ресурсов.
+ * @details Контекст игры создается с начальным значением из записи, такты и
+ * действия передаются модели в записанном порядке.
+ */
+int runReplay(const char* path, SimReport_t* report);
+
+/**
+ * @brief Добавляет результаты прогона `part` к сводным результатам `total`.
+ * @details Время прогона не суммируется.
+ */
+void mergeSimReport(SimReport_t* total, const SimReport_t* part);
+
+/**
+ * @brief Возвращает время (с), прошедшее с момента `start` (CLOCK_MONOTONIC).
+ */
+double elapsedSeconds(const struct timespec* start);
+
+/**
+ * @brief Выводит отчет о прогоне.
+ */
+void printSimReport(FILE* stream, const SimReport_t* report);
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * @file main.c
+ * @brief Точка входа headless-симулятора BrickGame.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Использование:
+ * @code
+ * tetris_sim [--seed N] [--games N] [--ticks N] [--actions PCT]
+ *            [--script LRUDAPS.] [--autoplay N] [--threads N]
+ * tetris_sim --replay FILE
+ * tetris_sim --field-bench ROWS [--seed N]
+ * @endcode
+ * С параметром `--threads` игры выполняются пакетом в пуле потоков
+ * (`--threads 0` — по количеству ядер), `--ticks` ограничивает одну игру.
+ * С параметром `--autoplay` действия выбирает автоматический игрок
+ * (autoplayer.h) с N потоками поиска хода (`--autoplay 0` — по количеству
+ * ядер).
+ * С параметром `--replay` симулятор воспроизводит запись сессии игры
+ * (input_log.h) с максимальной скоростью; при сборке с BRICKGAME_PROFILE
+ * выводится также отчет о длительностях участков модели.
+ * С параметром `--field-bench` симулятор сравнивает реализации удаления
+ * заполненных строк (field_simd.h) на поле высотой ROWS строк.
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../common/profiler.h"
+#include "../common/work_pool.h"
+#include "batch.h"
+#include "field_bench.h"
+
+static void printUsage(const char* name) {
+  fprintf(stderr,
+          "Usage: %s [--seed N] [--games N] [--ticks N] [--actions PCT] "
+          "[--script LRUDAPS.] [--autoplay N] [--threads N]\n"
+          "       %s --replay FILE\n"
+          "       %s --field-bench ROWS [--seed N]\n",
+          name, name, name);
+}
+
+static int parseArguments(int argc, char** argv, SimConfig_t* config,
+                          int* threads, const char** replay, int* benchRows) {
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) return 1;
+
+    const char* value = argv[++i];
+    char* end = NULL;
+    unsigned long long number = strtoull(value, &end, 10);
+    bool isNumber = *value != '\0' && *end == '\0';
+
+    if (!strcmp(argv[i - 1], "--replay")) {
+      *replay = value;
+    } else if (!strcmp(argv[i - 1], "--script")) {
+      config->policy = SIM_POLICY_SCRIPT;
+      config->script = value;
+    } else if (!isNumber) {
+      return 1;
+    } else if (!strcmp(argv[i - 1], "--seed")) {
+      config->seed = (uint64_t)number;
+    } else if (!strcmp(argv[i - 1], "--games")) {
+      config->maxGames = (unsigned long)number;
+    } else if (!strcmp(argv[i - 1], "--ticks")) {
+      config->maxTicks = (unsigned long)number;
+    } else if (!strcmp(argv[i - 1], "--threads") && number <= SIM_MAX_THREADS) {
+      *threads = number ? (int)number : availableCores();
+    } else if (!strcmp(argv[i - 1], "--autoplay") &&
+               number <= WORK_POOL_MAX_THREADS) {
+      config->policy = SIM_POLICY_AUTOPLAY;
+      config->autoplayThreads = (int)number;
+    } else if (!strcmp(argv[i - 1], "--field-bench") && number > 0 &&
+               number <= INT_MAX) {
+      *benchRows = (int)number;
+    } else if (!strcmp(argv[i - 1], "--actions") && number <= 100) {
+      config->actionPercent = (int)number;
+    } else {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  SimConfig_t config;
+  SimReport_t report;
+  int threads = 0;
+  const char* replay = NULL;
+  int benchRows = 0;
+
+  initSimConfig(&config);
+  if (parseArguments(argc, argv, &config, &threads, &replay, &benchRows)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (benchRows)
+    return runFieldBench(benchRows, config.seed, stdout) ? EXIT_FAILURE
+                                                         : EXIT_SUCCESS;
+
+  int error = replay    ? runReplay(replay, &report)
+              : threads ? runSimulationBatch(&config, threads, &report)
+                        : runSimulation(&config, &report);
+  if (error) {
+    fprintf(stderr, "Simulation failed\n");
+    return EXIT_FAILURE;
+  }
+
+  if (threads) printf("threads: %d\n", threads);
+  printSimReport(stdout, &report);
+#ifdef BRICKGAME_PROFILE
+  if (replay) printProfileReport(stdout);
+#endif
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,369 @@
+/**
+ * @file autoplayer.c
+ * @brief Реализация автоматического игрока Snake.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Один Autoplayer_t обслуживает один экземпляр игры и вызывается в
+ * потоке его игрового цикла: буферы поиска хранятся в Autoplayer_t, а
+ * состояние игры берется из локаторов, привязанных к этому потоку.
+ */
+
+#include "autoplayer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @def NUM_DIRECTIONS
+ * @brief Количество направлений движения (gameBlockOrientation)
+ */
+#define NUM_DIRECTIONS 4
+
+/**
+ * @def ANY_BODY_CELL
+ * @brief Цель поиска: любая клетка тела после ее освобождения
+ */
+#define ANY_BODY_CELL SNAKE_NO_CELL
+
+static const UserAction_t directionActions[NUM_DIRECTIONS] = {
+    [ToTop] = Up, [ToRight] = Right, [ToBottom] = Down, [ToLeft] = Left};
+
+struct Autoplayer_t {
+  int width;                                   ///< Ширина поля
+  int height;                                  ///< Высота поля
+  int cells;                                   ///< Количество клеток
+  int neighbors[SNAKE_CELLS][NUM_DIRECTIONS];  ///< Соседи клеток
+  int cycleOrder[SNAKE_CELLS];  ///< Номер клетки в гамильтоновом цикле
+  bool hasCycle;                ///< Гамильтонов цикл существует
+  unsigned int visitGeneration;           ///< Номер текущего поиска
+  unsigned int visited[SNAKE_CELLS];      ///< Метки посещения
+  int parent[SNAKE_CELLS];                ///< Предыдущая клетка пути
+  int arrival[SNAKE_CELLS];               ///< Шаг прихода головы
+  int queue[SNAKE_CELLS];                 ///< Очередь поиска
+  unsigned int bodyGeneration;            ///< Номер текущей разметки тела
+  unsigned int bodyStamp[SNAKE_CELLS];    ///< Метки клеток тела
+  int freeTime[SNAKE_CELLS];              ///< Шаг освобождения клетки тела
+  int body[SNAKE_CELLS];                  ///< Клетки тела (голова — 0)
+  int path[SNAKE_CELLS];                  ///< Путь к еде (еда — 0)
+  int virtualBody[SNAKE_CELLS];           ///< Тело после пути к еде
+  bool decided;                           ///< Шаг для lastHead выбран
+  int lastHead;                           ///< Голова при выборе шага
+  int lastFood;                           ///< Еда при выборе шага
+  gameBlockOrientation lastDirection;     ///< Выбранное направление
+};
+
+static void buildNeighbors(Autoplayer_t* player) {
+  static const int dx[NUM_DIRECTIONS] = {[ToRight] = 1, [ToLeft] = -1};
+  static const int dy[NUM_DIRECTIONS] = {[ToTop] = -1, [ToBottom] = 1};
+
+  for (int cell = 0; cell < player->cells; cell++) {
+    for (int direction = 0; direction < NUM_DIRECTIONS; direction++) {
+      int x = cell % player->width + dx[direction];
+      int y = cell / player->width + dy[direction];
+      player->neighbors[cell][direction] =
+          x >= 0 && x < player->width && y >= 0 && y < player->height
+              ? y * player->width + x
+              : SNAKE_NO_CELL;
+    }
+  }
+}
+
+/*
+ * Цикл строится для четного количества строк (иначе — столбцов): змейка
+ * обходит строки зигзагом по столбцам 1..width-1 и возвращается по
+ * столбцу 0. Если обе стороны нечетны, гамильтонова цикла нет.
+ */
+static bool buildCycle(Autoplayer_t* player) {
+  bool byRows = player->height % 2 == 0;
+  int across = byRows ? player->width : player->height;
+  int along = byRows ? player->height : player->width;
+  int order = 0;
+
+  if ((!byRows && player->width % 2) || across < 2) return false;
+
+  player->cycleOrder[0] = order++;
+  for (int v = 0; v < along; v++) {
+    for (int i = 1; i < across; i++) {
+      int u = v % 2 == 0 ? i : across - i;
+      player->cycleOrder[byRows ? v * player->width + u
+                                : u * player->width + v] = order++;
+    }
+  }
+  for (int v = along - 1; v > 0; v--)
+    player->cycleOrder[byRows ? v * player->width : v] = order++;
+
+  return true;
+}
+
+static unsigned int nextStamp(unsigned int* generation, unsigned int* stamps) {
+  if (++*generation == 0) {
+    memset(stamps, 0, SNAKE_CELLS * sizeof(unsigned int));
+    *generation = 1;
+  }
+
+  return *generation;
+}
+
+static void markBody(Autoplayer_t* player, const int* body, int length) {
+  unsigned int stamp =
+      nextStamp(&player->bodyGeneration, player->bodyStamp);
+
+  for (int i = 0; i < length; i++) {
+    player->bodyStamp[body[i]] = stamp;
+    player->freeTime[body[i]] = length - i;
+  }
+}
+
+// Шаг, начиная с которого клетку может занять голова (0 — свободна).
+static int cellFreeTime(const Autoplayer_t* player, int cell) {
+  return player->bodyStamp[cell] == player->bodyGeneration
+             ? player->freeTime[cell]
+             : 0;
+}
+
+/*
+ * Поиск в ширину от клетки start, в которой голова находится на шаге
+ * startTime. Клетка тела проходима, если голова приходит в нее не раньше
+ * шага освобождения. Возвращает найденную цель: клетку target или (при
+ * target == ANY_BODY_CELL) первую достижимую клетку тела — в нее голова
+ * входит вслед за хвостом.
+ */
+static int searchCells(Autoplayer_t* player, int start, int startTime,
+                       int target, int* area) {
+  unsigned int stamp =
+      nextStamp(&player->visitGeneration, player->visited);
+  int head = 0;
+  int tail = 0;
+  int found = SNAKE_NO_CELL;
+
+  player->visited[start] = stamp;
+  player->arrival[start] = startTime;
+  player->queue[tail++] = start;
+  while (head < tail && found == SNAKE_NO_CELL) {
+    int cell = player->queue[head++];
+    int time = player->arrival[cell] + 1;
+    for (int i = 0; i < NUM_DIRECTIONS && found == SNAKE_NO_CELL; i++) {
+      int next = player->neighbors[cell][i];
+      if (next == SNAKE_NO_CELL || player->visited[next] == stamp ||
+          cellFreeTime(player, next) > time)
+        continue;
+
+      player->visited[next] = stamp;
+      player->arrival[next] = time;
+      player->parent[next] = cell;
+      player->queue[tail++] = next;
+      if (next == target ||
+          (target == ANY_BODY_CELL && cellFreeTime(player, next) > 0))
+        found = next;
+    }
+  }
+  if (area) *area = tail;
+
+  return found;
+}
+
+/*
+ * Змейка после пути к еде: путь (еда — голова) и начало прежнего тела,
+ * длина больше прежней на 1. Положение безопасно, если голова может
+ * догнать хвост.
+ */
+static bool isSafeAfterEating(Autoplayer_t* player, int steps, int length) {
+  int grown = length + 1;
+  int count = 0;
+
+  if (grown >= player->cells) return true;
+
+  for (int i = 0; i < steps && count < grown; i++)
+    player->virtualBody[count++] = player->path[i];
+  for (int i = 0; count < grown; i++)
+    player->virtualBody[count++] = player->body[i];
+  markBody(player, player->virtualBody, grown);
+
+  return searchCells(player, player->virtualBody[0], 0, ANY_BODY_CELL,
+                     NULL) != SNAKE_NO_CELL;
+}
+
+static int cycleDistance(const Autoplayer_t* player, int from, int to) {
+  return (player->cycleOrder[to] - player->cycleOrder[from] +
+          player->cells) %
+         player->cells;
+}
+
+/*
+ * Тело лежит на цикле по порядку, если сумма расстояний по циклу между
+ * соседними сегментами равна расстоянию от хвоста до головы (тело не
+ * обходит цикл больше одного раза).
+ */
+static bool isBodyOnCycle(const Autoplayer_t* player, int length) {
+  int total = 0;
+
+  if (!player->hasCycle) return false;
+  for (int i = 1; i < length; i++)
+    total += cycleDistance(player, player->body[i], player->body[i - 1]);
+
+  return total == cycleDistance(player, player->body[length - 1],
+                                player->body[0]);
+}
+
+/*
+ * Для тела на цикле клетки между головой и хвостом по ходу цикла
+ * свободны. Шаг в такую клетку (сокращение цикла) сохраняет порядок тела,
+ * а шаг не дальше еды не пропускает ее, поэтому змейка на цикле не может
+ * запереть себя.
+ */
+static bool isCycleShortcut(const Autoplayer_t* player, int next, int food,
+                            int length) {
+  int head = player->body[0];
+  int tail = player->body[length - 1];
+  int distance = cycleDistance(player, head, next);
+
+  return distance > 0 &&
+         (food == SNAKE_NO_CELL ||
+          distance <= cycleDistance(player, head, food)) &&
+         (distance < cycleDistance(player, head, tail) || next == tail);
+}
+
+// Наиболее длинное сокращение цикла в сторону еды.
+static int followCycle(const Autoplayer_t* player, int length, int food) {
+  int head = player->body[0];
+  int best = SNAKE_NO_CELL;
+
+  for (int i = 0; i < NUM_DIRECTIONS; i++) {
+    int next = player->neighbors[head][i];
+    if (next != SNAKE_NO_CELL &&
+        isCycleShortcut(player, next, food, length) &&
+        (best == SNAKE_NO_CELL || cycleDistance(player, head, next) >
+                                      cycleDistance(player, head, best)))
+      best = next;
+  }
+
+  return best;
+}
+
+/*
+ * Для тела вне цикла (например, если игрок включен во время игры):
+ * ближайшая по циклу соседняя клетка (кроме еды), из которой голова может
+ * догнать хвост, иначе — соседняя клетка с наибольшей доступной областью.
+ */
+static int escapeToTail(Autoplayer_t* player, int length, int food) {
+  int head = player->body[0];
+  int safest = SNAKE_NO_CELL;
+  int safestArea = -1;
+  int best = SNAKE_NO_CELL;
+  int bestDistance = player->cells;
+
+  markBody(player, player->body, length);
+  for (int i = 0; i < NUM_DIRECTIONS; i++) {
+    int next = player->neighbors[head][i];
+    if (next == SNAKE_NO_CELL || cellFreeTime(player, next) > 1) continue;
+
+    int area = player->cells;
+    bool safe = cellFreeTime(player, next) == 1 ||
+                searchCells(player, next, 1, ANY_BODY_CELL, &area) !=
+                    SNAKE_NO_CELL;
+    int distance =
+        player->hasCycle ? cycleDistance(player, head, next) : 0;
+    if (safe && next != food && distance < bestDistance) {
+      best = next;
+      bestDistance = distance;
+    }
+    if (area > safestArea) {
+      safest = next;
+      safestArea = area;
+    }
+  }
+
+  return best != SNAKE_NO_CELL ? best : safest;
+}
+
+static int chooseCell(Autoplayer_t* player, const SnakeGame_t* game) {
+  int length = game->body->size;
+
+  for (int i = 0; i < length; i++) {
+    const GameBlock_t* segment = getGameBlock(game->body, i);
+    player->body[i] = segment->posY * player->width + segment->posX;
+  }
+  markBody(player, player->body, length);
+
+  int head = player->body[0];
+  int food = game->foodCell;
+  bool onCycle = isBodyOnCycle(player, length);
+  if (food != SNAKE_NO_CELL &&
+      searchCells(player, head, 0, food, NULL) == food) {
+    int steps = 0;
+    for (int cell = food; cell != head; cell = player->parent[cell])
+      player->path[steps++] = cell;
+
+    int next = player->path[steps - 1];
+    if (onCycle ? isCycleShortcut(player, next, food, length)
+                : isSafeAfterEating(player, steps, length))
+      return next;
+  }
+
+  return onCycle ? followCycle(player, length, food)
+                 : escapeToTail(player, length, food);
+}
+
+Autoplayer_t* createAutoplayer(int threads) {
+  (void)threads;
+  Autoplayer_t* player = calloc(1, sizeof(Autoplayer_t));
+
+  if (player) {
+    player->width = FIELD_WIDTH;
+    player->height = FIELD_HEIGHT;
+    player->cells = SNAKE_CELLS;
+    buildNeighbors(player);
+    player->hasCycle = buildCycle(player);
+  }
+
+  return player;
+}
+
+void destroyAutoplayer(Autoplayer_t* player) { free(player); }
+
+int planSnakeDirection(Autoplayer_t* player, gameBlockOrientation* direction) {
+  FiniteStateMachine* fsm = locateFSM(NULL);
+  SnakeGame_t* game = locateSnakeGame(NULL);
+
+  if (!player || !direction || !fsm || !game || !game->body ||
+      game->body->size == 0 || fsm->currentState != STATE_MOVE_DOWN ||
+      game->grid.occupancy.width != player->width ||
+      game->grid.occupancy.height != player->height)
+    return 1;
+
+  int next = chooseCell(player, game);
+  int head = player->body[0];
+  *direction = game->direction;
+  for (int i = 0; i < NUM_DIRECTIONS; i++)
+    if (next != SNAKE_NO_CELL && player->neighbors[head][i] == next)
+      *direction = (gameBlockOrientation)i;
+
+  return 0;
+}
+
+int autoplayMove(Autoplayer_t* player) {
+  SnakeGame_t* game = locateSnakeGame(NULL);
+  gameBlockOrientation direction;
+
+  if (!player || !game || !game->body || game->body->size == 0) return 0;
+
+  const GameBlock_t* segment = getGameBlock(game->body, 0);
+  int head = segment->posY * player->width + segment->posX;
+  if (player->decided && player->lastHead == head &&
+      player->lastFood == game->foodCell &&
+      player->lastDirection == game->nextDirection)
+    return 0;
+  if (planSnakeDirection(player, &direction)) return 0;
+
+  player->decided = true;
+  player->lastHead = head;
+  player->lastFood = game->foodCell;
+  player->lastDirection = direction;
+  if (direction == game->nextDirection) return 0;
+
+  userInput(directionActions[direction], false);
+
+  return 1;
+}
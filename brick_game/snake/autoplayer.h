@@ -0,0 +1,65 @@
+/**
+ * @file autoplayer.h
+ * @brief Автоматический игрок Snake
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует интерфейс автоматического игрока
+ * (common/autoplayer.h) для Snake. При создании игрока один раз
+ * вычисляются таблицы соседей клеток поля и гамильтонов цикл (обход всех
+ * клеток поля с возвратом в начальную клетку). Для каждого шага змейки:
+ *          - путь к еде ищется поиском в ширину (BFS) с учетом движения
+ *            тела: сегмент `i` (голова — 0) змейки длины `L` освобождает
+ *            клетку через `L - i` шагов, поэтому путь может проходить по
+ *            клеткам, которые хвост освободит к моменту прихода головы;
+ *          - пока тело лежит на цикле по порядку (как в начале игры),
+ *            первый шаг пути безопасен, если он сокращает цикл: ведет в
+ *            клетку между головой и хвостом по ходу цикла, не дальше еды.
+ *            Такой шаг сохраняет порядок тела, поэтому следующая по циклу
+ *            клетка всегда свободна или занята хвостом, и змейка не может
+ *            запереть себя;
+ *          - если шаг пути небезопасен, выбирается наиболее длинное
+ *            безопасное сокращение цикла (в крайнем случае — следующая по
+ *            циклу клетка);
+ *          - если тело не лежит на цикле (игрок включен во время игры),
+ *            путь безопасен, когда после съедания еды голова может догнать
+ *            хвост; иначе выбирается ближайшая по циклу клетка, из которой
+ *            голова догоняет хвост, в крайнем случае — соседняя клетка с
+ *            наибольшей доступной областью.
+ *
+ * Массивы посещения, родителей и времени освобождения клеток не очищаются
+ * перед поиском: запись действительна, если ее метка совпадает с номером
+ * текущего поиска (generation). Поэтому выбор шага выполняет не более шести
+ * поисков по клеткам поля независимо от длины змейки.
+ *
+ * Шаг выбирается один раз для каждого положения головы и передается модели
+ * действием направления (Up, Down, Left, Right), если отличается от уже
+ * заданного. Параметр `threads` функции createAutoplayer() не используется:
+ * поиск выполняется в вызывающем потоке.
+ */
+
+#ifndef SNAKE_AUTOPLAYER_H
+#define SNAKE_AUTOPLAYER_H
+
+#include "../common/autoplayer.h"
+#include "snake.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup AutoplayerRoutines
+ * @brief Выбирает направление следующего шага змейки, не передавая его
+ * модели.
+ * @return 0 в случае успеха, 1 если змейка не движется (состояние автомата
+ * отлично от STATE_MOVE_DOWN) или при ошибке параметров.
+ */
+int planSnakeDirection(Autoplayer_t* player, gameBlockOrientation* direction);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
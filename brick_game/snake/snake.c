@@ -0,0 +1,456 @@
+/**
+ * @file snake.c
+ * @brief Реализация модели игры Snake.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Все функции не потокобезопасны. Используйте в однопоточных
+ * приложениях.
+ */
+
+#include "snake.h"
+
+#include <stdlib.h>
+
+#include "../common/addr_locator.h"
+#include "../common/game_snapshot.h"
+#include "../common/session_arena.h"
+
+/**
+ * @def SNAKE_SNAPSHOT_TAG
+ * @brief Признак данных модели Snake в снимке состояния
+ */
+#define SNAKE_SNAPSHOT_TAG 'S'
+
+static int cellIndex(const SnakeGrid_t* grid, int x, int y) {
+  return y * grid->occupancy.width + x;
+}
+
+static bool isOpposite(gameBlockOrientation a, gameBlockOrientation b) {
+  return ((int)a + 2) % 4 == (int)b;
+}
+
+static void nextHeadPosition(const GameBlock_t* head,
+                             gameBlockOrientation direction, int* x, int* y) {
+  *x = head->posX;
+  *y = head->posY;
+  switch (direction) {
+    case ToTop:
+      --*y;
+      break;
+    case ToRight:
+      ++*x;
+      break;
+    case ToBottom:
+      ++*y;
+      break;
+    case ToLeft:
+      --*x;
+      break;
+  }
+}
+
+int initSnakeGrid(SnakeGrid_t* grid, int width, int height) {
+  if (!grid || initGameField(&grid->occupancy, width, height)) return 1;
+
+  grid->freeCount = width * height;
+  for (int i = 0; i < grid->freeCount; i++) {
+    grid->freeCells[i] = i;
+    grid->freeIndex[i] = i;
+  }
+
+  return 0;
+}
+
+bool isSnakeCellOccupied(const SnakeGrid_t* grid, int x, int y) {
+  return getFieldCell(&grid->occupancy, x, y);
+}
+
+void occupySnakeCell(SnakeGrid_t* grid, int x, int y) {
+  if (isSnakeCellOccupied(grid, x, y)) return;
+
+  int cell = cellIndex(grid, x, y);
+  int position = grid->freeIndex[cell];
+  int last = grid->freeCells[--grid->freeCount];
+
+  grid->freeCells[position] = last;
+  grid->freeIndex[last] = position;
+  grid->freeIndex[cell] = SNAKE_NO_CELL;
+  setFieldCell(&grid->occupancy, x, y, SNAKE_BODY_COLOR);
+}
+
+void releaseSnakeCell(SnakeGrid_t* grid, int x, int y) {
+  if (x < 0 || x >= grid->occupancy.width || y < 0 ||
+      y >= grid->occupancy.height || !isSnakeCellOccupied(grid, x, y))
+    return;
+
+  int cell = cellIndex(grid, x, y);
+  grid->freeCells[grid->freeCount] = cell;
+  grid->freeIndex[cell] = grid->freeCount++;
+  setFieldCell(&grid->occupancy, x, y, 0);
+}
+
+int pickFreeSnakeCell(const SnakeGrid_t* grid, unsigned int random) {
+  if (!grid || grid->freeCount == 0) return SNAKE_NO_CELL;
+
+  return grid->freeCells[random % (unsigned int)grid->freeCount];
+}
+
+SnakeGame_t* createSnakeGame() {
+  SessionArena_t* arena = locateSessionArena(NULL);
+  SnakeGame_t* game =
+      arenaAllocAligned(arena, sizeof(SnakeGame_t), ARENA_CACHE_LINE);
+
+  if (game) {
+    if ((game->body = createGameBlockQueue()) == NULL ||
+        initSnakeGrid(&game->grid, FIELD_WIDTH, FIELD_HEIGHT)) {
+      destroyGameBlockQueue(game->body);
+      return NULL;
+    }
+    game->direction = ToRight;
+    game->nextDirection = ToRight;
+    game->foodCell = SNAKE_NO_CELL;
+    locateSnakeGame(game);
+  }
+
+  return game;
+}
+
+void destroySnakeGame(SnakeGame_t* game) {
+  if (game) {
+    if (game == locateSnakeGame(NULL)) {
+      locateSnakeGame(game);
+    }
+    destroyGameBlockQueue(game->body);
+    game->body = NULL;
+  }
+}
+
+SnakeGame_t* locateSnakeGame(SnakeGame_t* game) {
+  static AddressLocator_t locator = {NULL, false};
+  AddressLocator_t* current = resolveLocator(&locator, LOCATOR_GAME_MODEL);
+  return (SnakeGame_t*)updateLocator(current, game);
+}
+
+int resetSnakeGame(SnakeGame_t* game, unsigned int random) {
+  if (!game || !game->body) return 1;
+
+  SnakeGrid_t* grid = &game->grid;
+  initSnakeGrid(grid, grid->occupancy.width, grid->occupancy.height);
+  populateGameBlockQueue(game->body);
+
+  int headX = (grid->occupancy.width + SNAKE_INITIAL_LENGTH) / 2 - 1;
+  int headY = grid->occupancy.height / 2;
+  for (int i = SNAKE_INITIAL_LENGTH - 1; i >= 0; i--) {
+    GameBlock_t segment;
+    initGameBlock(&segment, headX - i, headY, MIN_GAMEBLOCK_SIZE, ToRight, 0);
+    insertGameBlock(game->body, &segment);
+    occupySnakeCell(grid, segment.posX, segment.posY);
+  }
+
+  game->direction = ToRight;
+  game->nextDirection = ToRight;
+  game->foodCell = pickFreeSnakeCell(grid, random);
+
+  return 0;
+}
+
+int turnSnake(SnakeGame_t* game, gameBlockOrientation direction) {
+  if (!game || isOpposite(game->direction, direction)) return 1;
+
+  game->nextDirection = direction;
+  return 0;
+}
+
+SnakeStepResult stepSnake(SnakeGame_t* game, unsigned int random) {
+  SnakeGrid_t* grid = &game->grid;
+  GameBlock_t head = *getGameBlock(game->body, 0);
+  int x = 0;
+  int y = 0;
+
+  game->direction = game->nextDirection;
+  nextHeadPosition(&head, game->direction, &x, &y);
+
+  bool ate = game->foodCell != SNAKE_NO_CELL &&
+             !isSnakeCellOccupied(grid, x, y) &&
+             cellIndex(grid, x, y) == game->foodCell;
+  // Клетку хвоста голова может занять, если змейка не растет.
+  const GameBlock_t* tail = getGameBlock(game->body, game->body->size - 1);
+  bool intoTail = !ate && tail->posX == x && tail->posY == y;
+  if (isSnakeCellOccupied(grid, x, y) && !intoTail) return SNAKE_COLLIDED;
+
+  if (!ate) {
+    GameBlock_t released;
+    popBackGameBlock(game->body, &released);
+    releaseSnakeCell(grid, released.posX, released.posY);
+  }
+
+  head.posX = x;
+  head.posY = y;
+  head.orientation = game->direction;
+  insertGameBlock(game->body, &head);
+  occupySnakeCell(grid, x, y);
+
+  if (!ate) return SNAKE_MOVED;
+
+  game->foodCell = pickFreeSnakeCell(grid, random);
+  return game->foodCell == SNAKE_NO_CELL ? SNAKE_WON : SNAKE_ATE;
+}
+
+int snakeToMatrix(const SnakeGame_t* game, int** matrix) {
+  if (!game || fieldToMatrix(&game->grid.occupancy, matrix)) return 1;
+
+  if (game->foodCell != SNAKE_NO_CELL) {
+    int width = game->grid.occupancy.width;
+    matrix[game->foodCell / width][game->foodCell % width] = SNAKE_FOOD_COLOR;
+  }
+
+  return 0;
+}
+
+static void snakeStep(GameInfo_t* info) {
+  SnakeStepResult result = stepSnake(locateSnakeGame(NULL), gameRandom());
+
+  if (result == SNAKE_ATE || result == SNAKE_WON) {
+    ++getGameCounters()->pieces;
+    ++info->score;
+    if (info->score > info->high_score) info->high_score = info->score;
+    info->level = 1 + info->score / SNAKE_LEVEL_SCORE;
+    if (info->level > SNAKE_MAX_LEVEL) info->level = SNAKE_MAX_LEVEL;
+    info->speed = info->level;
+  }
+
+  if (result == SNAKE_COLLIDED) {
+    fsm_processTrigger(locateFSM(NULL), TRIGGER_COLLISION);
+  } else if (result == SNAKE_WON) {
+    fsm_processTrigger(locateFSM(NULL), TRIGGER_GAME_OVER);
+  }
+}
+
+static void onStartEnter(void* context) {
+  GameInfo_t* info = (GameInfo_t*)context;
+
+  resetSnakeGame(locateSnakeGame(NULL), gameRandom());
+  info->score = 0;
+  info->level = 1;
+  info->speed = 1;
+  info->pause = 0;
+
+  fsm_processTrigger(locateFSM(NULL), TRIGGER_SPAWN);
+}
+
+static void onMoveUpdate(void* context) { snakeStep((GameInfo_t*)context); }
+
+static void onBoostEnter(void* context) {
+  FiniteStateMachine* fsm = locateFSM(NULL);
+
+  snakeStep((GameInfo_t*)context);
+  if (fsm->currentState == STATE_ROTATE)
+    fsm_processTrigger(fsm, TRIGGER_RESUME);
+}
+
+static void onTurnUp(void* context) {
+  (void)context;
+  turnSnake(locateSnakeGame(NULL), ToTop);
+}
+
+static void onTurnDown(void* context) {
+  (void)context;
+  turnSnake(locateSnakeGame(NULL), ToBottom);
+}
+
+static void onTurnLeft(void* context) {
+  (void)context;
+  turnSnake(locateSnakeGame(NULL), ToLeft);
+}
+
+static void onTurnRight(void* context) {
+  (void)context;
+  turnSnake(locateSnakeGame(NULL), ToRight);
+}
+
+static void onPauseEnter(void* context) { ((GameInfo_t*)context)->pause = 1; }
+
+static void onPauseExit(void* context) { ((GameInfo_t*)context)->pause = 0; }
+
+static void onGameOverEnter(void* context) {
+  GameInfo_t* info = (GameInfo_t*)context;
+
+  if (info->score > info->high_score) info->high_score = info->score;
+  ++getGameCounters()->games;
+}
+
+static const Transition idleTransitions[] = {
+    {TRIGGER_START_GAME, STATE_START, NULL},  // Старт игры
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}  // Выход из приложения
+};
+
+static const Transition startTransitions[] = {
+    {TRIGGER_SPAWN, STATE_MOVE_DOWN, NULL},  // Начать движение
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition moveTransitions[] = {
+    {TRIGGER_MOVE_UP, STATE_MOVE_DOWN, onTurnUp},        // Поворот вверх
+    {TRIGGER_MOVE_DOWN, STATE_MOVE_DOWN, onTurnDown},    // Поворот вниз
+    {TRIGGER_MOVE_LEFT, STATE_MOVE_DOWN, onTurnLeft},    // Поворот влево
+    {TRIGGER_MOVE_RIGHT, STATE_MOVE_DOWN, onTurnRight},  // Поворот вправо
+    {TRIGGER_ROTATE, STATE_ROTATE, NULL},                // Ускорение
+    {TRIGGER_PAUSE, STATE_PAUSE, NULL},                  // Пауза
+    {TRIGGER_COLLISION, STATE_GAME_OVER, NULL},          // Столкновение
+    {TRIGGER_GAME_OVER, STATE_GAME_OVER, NULL},          // Поле заполнено
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition boostTransitions[] = {
+    {TRIGGER_RESUME, STATE_MOVE_DOWN, NULL},  // Возврат к движению
+    {TRIGGER_COLLISION, STATE_GAME_OVER, NULL},
+    {TRIGGER_GAME_OVER, STATE_GAME_OVER, NULL}};
+
+static const Transition pauseTransitions[] = {
+    {TRIGGER_PAUSE, STATE_MOVE_DOWN, NULL},   // Повторное нажатие паузы
+    {TRIGGER_RESUME, STATE_MOVE_DOWN, NULL},  // Продолжить игру
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition gameOverTransitions[] = {
+    {TRIGGER_START_GAME, STATE_START, NULL},  // Рестарт
+    {TRIGGER_INIT, STATE_START, NULL},        // Рестарт
+    {TRIGGER_EXIT, STATE_IDLE, NULL},         // Выход
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+const FSMState gameStates[NUM_STATES] = {
+    [STATE_IDLE] = {.id = STATE_IDLE, FSM_TRANSITIONS(idleTransitions)},
+    [STATE_START] = {.id = STATE_START,
+                     .onEnter = onStartEnter,  // Инициализация игры
+                     FSM_TRANSITIONS(startTransitions)},
+    [STATE_TERMINATE] = {.id = STATE_TERMINATE},
+    [STATE_SPAWN] = {.id = STATE_SPAWN},
+    [STATE_MOVE_DOWN] = {.id = STATE_MOVE_DOWN,
+                         .onUpdate = onMoveUpdate,  // Шаг по таймеру
+                         FSM_TRANSITIONS(moveTransitions)},
+    [STATE_MOVE_UP] = {.id = STATE_MOVE_UP},
+    [STATE_MOVE_LEFT] = {.id = STATE_MOVE_LEFT},
+    [STATE_MOVE_RIGHT] = {.id = STATE_MOVE_RIGHT},
+    [STATE_ROTATE] = {.id = STATE_ROTATE,
+                      .onEnter = onBoostEnter,  // Внеочередной шаг
+                      FSM_TRANSITIONS(boostTransitions)},
+    [STATE_PAUSE] = {.id = STATE_PAUSE,
+                     .onEnter = onPauseEnter,
+                     .onExit = onPauseExit,
+                     FSM_TRANSITIONS(pauseTransitions)},
+    [STATE_GAME_OVER] = {.id = STATE_GAME_OVER,
+                         .onEnter = onGameOverEnter,  // Показать результат
+                         FSM_TRANSITIONS(gameOverTransitions)}};
+
+_Static_assert(FSM_ARRAY_SIZE(gameStates) == NUM_STATES,
+               "Snake state table must describe every StateID");
+
+bool isRepeatableAction(UserAction_t action) {
+  // Повтор поворота не меняет направления, удержание Action ускоряет змейку.
+  return action == Action;
+}
+
+int createGameModel() { return createSnakeGame() ? 0 : 1; }
+
+void destroyGameModel() { destroySnakeGame(locateSnakeGame(NULL)); }
+
+void encodeGameModel(SnapshotWriter_t* writer) {
+  SnakeGame_t* game = locateSnakeGame(NULL);
+  uint8_t tag = SNAKE_SNAPSHOT_TAG;
+  uint8_t directions[] = {(uint8_t)game->direction,
+                          (uint8_t)game->nextDirection};
+  int16_t food = (int16_t)game->foodCell;
+  uint16_t length = (uint16_t)game->body->size;
+
+  WRITE_SNAPSHOT_VALUE(writer, tag);
+  WRITE_SNAPSHOT_VALUE(writer, directions);
+  WRITE_SNAPSHOT_VALUE(writer, food);
+  WRITE_SNAPSHOT_VALUE(writer, length);
+  for (int i = 0; i < game->body->size; i++)
+    writeSnapshotBlock(writer, getGameBlock(game->body, i));
+}
+
+/*
+ * Тело проверяется по временной сетке: сегменты внутри поля, соседние по
+ * стороне клетки, без самопересечений, текущее и следующее направления не
+ * ведут из головы в соседний сегмент, еда — на свободной клетке.
+ */
+static bool isValidSnake(const SnakeGame_t* game, const GameBlock_t* body,
+                         int length, const uint8_t* directions, int food) {
+  int width = game->grid.occupancy.width;
+  int height = game->grid.occupancy.height;
+  bool occupied[SNAKE_CELLS] = {false};
+
+  for (int i = 0; i < length; i++) {
+    const GameBlock_t* segment = &body[i];
+    if (segment->size != MIN_GAMEBLOCK_SIZE || segment->posX < 0 ||
+        segment->posX >= width || segment->posY < 0 ||
+        segment->posY >= height)
+      return false;
+    int step = i > 0 ? abs(segment->posX - body[i - 1].posX) +
+                           abs(segment->posY - body[i - 1].posY)
+                     : 1;
+    if (step != 1) return false;
+    int cell = cellIndex(&game->grid, segment->posX, segment->posY);
+    if (occupied[cell]) return false;
+    occupied[cell] = true;
+  }
+  for (int i = 0; length > 1 && i < 2; i++) {
+    int x = 0;
+    int y = 0;
+    nextHeadPosition(&body[0], (gameBlockOrientation)directions[i], &x, &y);
+    if (x == body[1].posX && y == body[1].posY) return false;
+  }
+
+  return food == SNAKE_NO_CELL ||
+         (food >= 0 && food < width * height && !occupied[food]);
+}
+
+int decodeGameModel(SnapshotReader_t* reader, const GameField_t* field) {
+  // Занятость клеток змейки хранится в ее сетке, а не в поле.
+  (void)field;
+  SnakeGame_t* game = locateSnakeGame(NULL);
+  GameBlock_t body[SNAKE_CELLS];
+  uint8_t tag = 0;
+  uint8_t directions[2] = {0};
+  int16_t food = 0;
+  uint16_t length = 0;
+
+  READ_SNAPSHOT_VALUE(reader, tag);
+  READ_SNAPSHOT_VALUE(reader, directions);
+  READ_SNAPSHOT_VALUE(reader, food);
+  READ_SNAPSHOT_VALUE(reader, length);
+  if (!game || reader->failed || tag != SNAKE_SNAPSHOT_TAG ||
+      directions[0] > ToLeft || directions[1] > ToLeft || length < 1 ||
+      length > SNAKE_CELLS)
+    return 1;
+  for (int i = 0; i < length; i++) readSnapshotBlock(reader, &body[i]);
+  if (reader->failed || reader->position != reader->size ||
+      !isValidSnake(game, body, length, directions, food))
+    return 1;
+
+  SnakeGrid_t* grid = &game->grid;
+  initSnakeGrid(grid, grid->occupancy.width, grid->occupancy.height);
+  populateGameBlockQueue(game->body);
+  for (int i = 0; i < length; i++) {
+    pushBackGameBlock(game->body, &body[i]);
+    occupySnakeCell(grid, body[i].posX, body[i].posY);
+  }
+  game->direction = (gameBlockOrientation)directions[0];
+  game->nextDirection = (gameBlockOrientation)directions[1];
+  game->foodCell = food;
+
+  return 0;
+}
+
+GameInfo_t updateCurrentState() {
+  GameInfo_t gameinfo = {0};
+  GameInfo_t* current = locateGameInfo(NULL);
+  SnakeGame_t* game = locateSnakeGame(NULL);
+
+  if (current) {
+    gameinfo = *current;
+    if (game && game->body->size > 0) snakeToMatrix(game, gameinfo.field);
+  }
+
+  return gameinfo;
+}
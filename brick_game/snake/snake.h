@@ -0,0 +1,218 @@
+/**
+ * @file snake.h
+ * @brief Реализация модели игры Snake
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует модель игры Snake на основе общих компонент
+ * BrickGame (brick_game.h):
+ *          - тело змейки хранится в очереди блоков (GameBlockQueue_t), голова
+ *            змейки — первый элемент очереди;
+ *          - занятость клеток телом змейки хранится в битовом поле
+ *            (GameField_t), поэтому проверка столкновения головы с телом или
+ *            стеной — проверка одного бита;
+ *          - свободные клетки хранятся в массиве индексов с удалением
+ *            перестановкой (swap-remove), поэтому еда размещается равномерно
+ *            на свободной клетке за O(1), без повторных попыток.
+ *
+ * Логика игры задана матрицей состояний gameStates для конечного автомата
+ * (fsm.h):
+ *          - STATE_MOVE_DOWN — движение змейки, один вызов fsm_update()
+ *            перемещает змейку на одну клетку; триггеры направлений меняют
+ *            направление на следующем шаге;
+ *          - STATE_ROTATE — ускорение (Action): внеочередной шаг с возвратом
+ *            к движению (TRIGGER_RESUME);
+ *          - TRIGGER_COLLISION — столкновение, конец игры.
+ */
+
+#ifndef SNAKE_H
+#define SNAKE_H
+
+#include "../common/brick_game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def SNAKE_INITIAL_LENGTH
+ * @brief Длина змейки в начале игры
+ */
+#define SNAKE_INITIAL_LENGTH 4
+
+/**
+ * @def SNAKE_CELLS
+ * @brief Количество клеток поля игры Snake
+ */
+#define SNAKE_CELLS (FIELD_HEIGHT * FIELD_WIDTH)
+
+/**
+ * @def SNAKE_MAX_LEVEL
+ * @brief Максимальный уровень игры
+ */
+#define SNAKE_MAX_LEVEL 10
+
+/**
+ * @def SNAKE_LEVEL_SCORE
+ * @brief Количество очков для перехода на следующий уровень
+ */
+#define SNAKE_LEVEL_SCORE 5
+
+/**
+ * @def SNAKE_BODY_COLOR
+ * @brief Цвет клеток тела змейки на поле
+ */
+#define SNAKE_BODY_COLOR 1
+
+/**
+ * @def SNAKE_FOOD_COLOR
+ * @brief Цвет клетки еды на поле
+ */
+#define SNAKE_FOOD_COLOR 2
+
+/**
+ * @def SNAKE_NO_CELL
+ * @brief Признак отсутствия клетки (например, еды на поле)
+ */
+#define SNAKE_NO_CELL (-1)
+
+/**
+ * @enum SnakeStepResult
+ * @brief Результат перемещения змейки на один шаг.
+ */
+typedef enum {
+  SNAKE_MOVED,     ///< Змейка переместилась
+  SNAKE_ATE,       ///< Змейка съела еду и выросла
+  SNAKE_COLLIDED,  ///< Столкновение со стеной или телом
+  SNAKE_WON        ///< Змейка заняла все поле
+} SnakeStepResult;
+
+/**
+ * @struct SnakeGrid_t
+ * @brief Структура занятости клеток поля игры Snake.
+ * @details Клетка с координатами (x, y) имеет индекс `y * width + x`.
+ * Массив `freeCells` в первых `freeCount` элементах хранит индексы свободных
+ * клеток, массив `freeIndex` — позицию каждой свободной клетки в `freeCells`.
+ */
+typedef struct SnakeGrid_t {
+  GameField_t occupancy;         ///< Битовое поле занятости клеток телом
+  int freeCells[SNAKE_CELLS];    ///< Индексы свободных клеток
+  int freeIndex[SNAKE_CELLS];    ///< Позиции клеток в freeCells
+  int freeCount;                 ///< Количество свободных клеток
+} SnakeGrid_t;
+
+/**
+ * @struct SnakeGame_t
+ * @brief Структура состояния игры Snake.
+ */
+typedef struct SnakeGame_t {
+  SnakeGrid_t grid;                  ///< Занятость клеток поля
+  GameBlockQueue_t* body;            ///< Тело змейки (голова — элемент 0)
+  gameBlockOrientation direction;    ///< Текущее направление движения
+  gameBlockOrientation nextDirection;  ///< Направление на следующем шаге
+  int foodCell;                      ///< Индекс клетки еды или SNAKE_NO_CELL
+} SnakeGame_t;
+
+/**
+ * @defgroup SnakeGridRoutines Функции учета занятости клеток Snake
+ * @brief Функции работы с битовым полем и списком свободных клеток
+ */
+
+/**
+ * @ingroup SnakeGridRoutines
+ * @brief Инициализирует сетку: все клетки свободны.
+ * @return 0 в случае успеха, 1 при недопустимых параметрах.
+ */
+int initSnakeGrid(SnakeGrid_t* grid, int width, int height);
+
+/**
+ * @ingroup SnakeGridRoutines
+ * @brief Проверяет занятость клетки телом змейки (за пределами поля — занято).
+ */
+bool isSnakeCellOccupied(const SnakeGrid_t* grid, int x, int y);
+
+/**
+ * @ingroup SnakeGridRoutines
+ * @brief Отмечает клетку занятой и удаляет ее из списка свободных за O(1).
+ */
+void occupySnakeCell(SnakeGrid_t* grid, int x, int y);
+
+/**
+ * @ingroup SnakeGridRoutines
+ * @brief Освобождает клетку и добавляет ее в список свободных за O(1).
+ */
+void releaseSnakeCell(SnakeGrid_t* grid, int x, int y);
+
+/**
+ * @ingroup SnakeGridRoutines
+ * @brief Выбирает случайную свободную клетку за O(1).
+ * @param random Случайное число (источник случайности задает вызывающий).
+ * @return Индекс свободной клетки или SNAKE_NO_CELL, если свободных нет.
+ */
+int pickFreeSnakeCell(const SnakeGrid_t* grid, unsigned int random);
+
+/**
+ * @defgroup SnakeRoutines Функции модели игры Snake
+ * @brief Функции создания и изменения состояния игры Snake
+ */
+
+/**
+ * @ingroup SnakeRoutines
+ * @brief Создает состояние игры Snake в арене текущей сессии.
+ * @return Указатель на состояние игры или NULL при ошибке выделения памяти.
+ * @details Адрес сохраняется в локаторе (locateSnakeGame).
+ */
+SnakeGame_t* createSnakeGame();
+
+/**
+ * @ingroup SnakeRoutines
+ * @brief Уничтожает состояние игры Snake.
+ */
+void destroySnakeGame(SnakeGame_t* game);
+
+/**
+ * @ingroup AddressProviders
+ * @brief Функция локатор состояния игры Snake.
+ * @details Поведение аналогично locateGameInfo().
+ */
+SnakeGame_t* locateSnakeGame(SnakeGame_t* game);
+
+/**
+ * @ingroup SnakeRoutines
+ * @brief Начинает новую игру: змейка длины SNAKE_INITIAL_LENGTH в центре поля
+ * и еда на случайной свободной клетке.
+ * @param random Случайное число для размещения еды.
+ * @return 0 в случае успеха, 1 при ошибке.
+ */
+int resetSnakeGame(SnakeGame_t* game, unsigned int random);
+
+/**
+ * @ingroup SnakeRoutines
+ * @brief Задает направление движения на следующем шаге.
+ * @return 0 в случае успеха, 1 если направление противоположно текущему.
+ */
+int turnSnake(SnakeGame_t* game, gameBlockOrientation direction);
+
+/**
+ * @ingroup SnakeRoutines
+ * @brief Перемещает змейку на один шаг.
+ * @param random Случайное число для размещения новой еды.
+ * @return Результат шага (SnakeStepResult).
+ * @details Голова может занять клетку, которую на этом шаге покидает хвост
+ * (если змейка не растет). При столкновении тело змейки не изменяется.
+ */
+SnakeStepResult stepSnake(SnakeGame_t* game, unsigned int random);
+
+/**
+ * @ingroup SnakeRoutines
+ * @brief Формирует матричное представление поля (тело и еда).
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ */
+int snakeToMatrix(const SnakeGame_t* game, int** matrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file game_timer_test.c
+ * @brief Тесты службы таймеров (game_timer.h).
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Время задается виртуальными часами: таймеры опрашиваются с
+ * опозданием относительно срока, как в цикле контроллера, и расписание не
+ * должно зависеть от опозданий, кроме остановок дольше TIMER_MAX_CATCH_UP
+ * периодов.
+ */
+
+#include "../../common/game_timer.h"
+#include "../test.h"
+
+/**
+ * @def INTERVAL
+ * @brief Период таймера теста, нс
+ */
+#define INTERVAL (20 * NSEC_PER_MSEC)
+
+/**
+ * @def START
+ * @brief Момент запуска таймера теста, нс
+ */
+#define START (3 * NSEC_PER_SEC)
+
+static VirtualClock_t clockTime;
+static GameTimerService_t timers;
+
+static void setup(void) {
+  clockTime.time = START;
+  initTimerService(&timers);
+  ck_assert_int_eq(
+      startTimer(&timers, TIMER_GRAVITY, INTERVAL, INTERVAL, clockTime.time),
+      0);
+}
+
+static int64_t deadline(void) {
+  return timers.timers[TIMER_GRAVITY].deadline;
+}
+
+// Опрашивает таймеры с опозданием `lateness` после ближайшего срока и
+// проверяет, что сработал таймер падения.
+static void fireLate(int64_t lateness) {
+  int64_t wait = timeUntilNextTimer(&timers, clockTime.time);
+
+  ck_assert_int_ge(wait, 0);
+  advanceVirtualClock(&clockTime, wait + lateness);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_GRAVITY);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_NONE);
+}
+
+// Опоздания опроса не смещают расписание: N-е срабатывание приходится на
+// START + N·INTERVAL плюс длительность паузы.
+START_TEST(scheduleWithPause) {
+  const int periods = 10;
+  const int64_t pause = 7 * INTERVAL + INTERVAL / 3;
+  int64_t paused = 0;
+
+  for (int i = 1; i <= periods; i++) {
+    ck_assert_int_eq(deadline(), START + i * INTERVAL + paused);
+    fireLate(i % 4 * INTERVAL / 5);
+    if (i == periods / 2) {
+      pauseTimerService(&timers, clockTime.time);
+      advanceVirtualClock(&clockTime, pause);
+      ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_NONE);
+      ck_assert_int_eq(timeUntilNextTimer(&timers, clockTime.time), -1);
+      resumeTimerService(&timers, clockTime.time);
+      paused = pause;
+    }
+  }
+  ck_assert_int_eq(deadline(), START + (periods + 1) * INTERVAL + pause);
+}
+END_TEST
+
+// Таймер, запущенный на паузе, отсчитывает задержку от возобновления.
+START_TEST(startWhilePaused) {
+  pauseTimerService(&timers, clockTime.time);
+  advanceVirtualClock(&clockTime, INTERVAL / 2);
+  startTimer(&timers, TIMER_DAS, INTERVAL, 0, clockTime.time);
+  advanceVirtualClock(&clockTime, 3 * INTERVAL);
+  resumeTimerService(&timers, clockTime.time);
+
+  ck_assert_int_eq(timeUntilNextTimer(&timers, clockTime.time), INTERVAL);
+  advanceVirtualClock(&clockTime, INTERVAL);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_GRAVITY);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_DAS);
+  ck_assert_int_eq(isTimerActive(&timers, TIMER_DAS), false);
+}
+END_TEST
+
+// Остановка короче TIMER_MAX_CATCH_UP периодов: пропущенные срабатывания
+// выполняются подряд, расписание сохраняется.
+START_TEST(catchUpShortStall) {
+  const int missed = TIMER_MAX_CATCH_UP - 1;
+
+  advanceVirtualClock(&clockTime, missed * INTERVAL + INTERVAL / 2);
+  for (int i = 0; i < missed; i++)
+    ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_GRAVITY);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_NONE);
+  ck_assert_int_eq(deadline(), START + (missed + 1) * INTERVAL);
+}
+END_TEST
+
+// Остановка дольше TIMER_MAX_CATCH_UP периодов: одно срабатывание и новое
+// расписание от текущего момента.
+START_TEST(resyncLongStall) {
+  advanceVirtualClock(&clockTime, (TIMER_MAX_CATCH_UP + 3) * INTERVAL);
+  int64_t now = clockTime.time;
+
+  ck_assert_int_eq(pollExpiredTimer(&timers, now), TIMER_GRAVITY);
+  ck_assert_int_eq(pollExpiredTimer(&timers, now), TIMER_NONE);
+  ck_assert_int_eq(deadline(), now + INTERVAL);
+  fireLate(0);
+  ck_assert_int_eq(clockTime.time, now + INTERVAL);
+}
+END_TEST
+
+START_TEST(oneShot) {
+  startTimer(&timers, TIMER_LOCK_DELAY, INTERVAL / 2, 0, clockTime.time);
+  advanceVirtualClock(&clockTime, 10 * INTERVAL);
+
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time),
+                   TIMER_LOCK_DELAY);
+  ck_assert_int_eq(isTimerActive(&timers, TIMER_LOCK_DELAY), false);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_GRAVITY);
+  ck_assert_int_eq(pollExpiredTimer(&timers, clockTime.time), TIMER_NONE);
+}
+END_TEST
+
+Suite* gameTimerSuite(void) {
+  Suite* suite = suite_create("game_timer");
+  TCase* tcase = tcase_create("poll");
+
+  tcase_add_checked_fixture(tcase, setup, NULL);
+  tcase_add_test(tcase, scheduleWithPause);
+  tcase_add_test(tcase, startWhilePaused);
+  tcase_add_test(tcase, catchUpShortStall);
+  tcase_add_test(tcase, resyncLongStall);
+  tcase_add_test(tcase, oneShot);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file input_log_test.c
+ * @brief Тесты записи и чтения сессии (input_log.h).
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Записи формируются побайтно во временном файле: проверяется
+ * разбор заголовка и чисел varint обрезанной, слишком длинной или
+ * несогласованной записи.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../common/input_log.h"
+#include "../test.h"
+
+/**
+ * @def HEADER_SIZE
+ * @brief Размер заголовка записи с начальным значением 1
+ */
+#define HEADER_SIZE (4 + 1 + 1)
+
+/**
+ * @def VARINT_MAX_BYTES
+ * @brief Наибольшая длина числа varint (64 бита)
+ */
+#define VARINT_MAX_BYTES 10
+
+static char path[] = "/tmp/brick_game_input_logXXXXXX";
+static const uint8_t header[HEADER_SIZE] = {'B', 'G', 'I', 'L',
+                                            INPUT_LOG_VERSION, TEST_SEED};
+
+static void setup(void) {
+  strcpy(path + strlen(path) - 6, "XXXXXX");
+  int fd = mkstemp(path);
+  ck_assert_int_ge(fd, 0);
+  close(fd);
+}
+
+static void teardown(void) { unlink(path); }
+
+static void writeBytes(const uint8_t* bytes, size_t size) {
+  FILE* file = fopen(path, "wb");
+
+  ck_assert_ptr_nonnull(file);
+  ck_assert_uint_eq(fwrite(bytes, 1, size, file), size);
+  ck_assert_int_eq(fclose(file), 0);
+}
+
+// Запись из заголовка и событий `events` размера `size`.
+static void writeLog(const uint8_t* events, size_t size) {
+  uint8_t bytes[HEADER_SIZE + 2 * VARINT_MAX_BYTES];
+
+  memcpy(bytes, header, HEADER_SIZE);
+  memcpy(bytes + HEADER_SIZE, events, size);
+  writeBytes(bytes, HEADER_SIZE + size);
+}
+
+// Записывает `value` в `bytes` кратчайшим образом, возвращает длину.
+static size_t encodeVarint(uint8_t* bytes, uint64_t value) {
+  size_t size = 0;
+
+  for (; value >= 0x80; value >>= 7)
+    bytes[size++] = (uint8_t)((value & 0x7f) | 0x80);
+  bytes[size++] = (uint8_t)value;
+
+  return size;
+}
+
+// Статус чтения первого события записи.
+static InputLogStatus readFirstEvent(InputLogEvent_t* event) {
+  InputLogReader_t* reader = openInputLog(path, NULL);
+
+  ck_assert_ptr_nonnull(reader);
+  InputLogStatus status = readInputLogEvent(reader, event);
+  closeInputLog(reader);
+
+  return status;
+}
+
+START_TEST(roundTrip) {
+  VirtualClock_t time = {0};
+  GameClock_t clock = virtualGameClock(&time);
+  InputLog_t* log = createInputLog(path, TEST_SEED, &clock);
+  InputLogEvent_t event;
+  uint64_t seed = 0;
+
+  ck_assert_ptr_nonnull(log);
+  advanceVirtualClock(&time, 3 * INPUT_LOG_TIME_UNIT);
+  ck_assert_int_eq(logUserAction(log, Left, true), 0);
+  advanceVirtualClock(&time, 1000000 * INPUT_LOG_TIME_UNIT);
+  ck_assert_int_eq(logModelTick(log), 0);
+  ck_assert_int_eq(destroyInputLog(log), 0);
+
+  InputLogReader_t* reader = openInputLog(path, &seed);
+  ck_assert_ptr_nonnull(reader);
+  ck_assert_uint_eq(seed, TEST_SEED);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_OK);
+  ck_assert_int_eq(event.type, INPUT_LOG_ACTION);
+  ck_assert_int_eq(event.action, Left);
+  ck_assert_int_eq(event.hold, true);
+  ck_assert_int_eq(event.time, 3 * INPUT_LOG_TIME_UNIT);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_OK);
+  ck_assert_int_eq(event.type, INPUT_LOG_TICK);
+  ck_assert_int_eq(event.time, 1000003 * INPUT_LOG_TIME_UNIT);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_END);
+  closeInputLog(reader);
+}
+END_TEST
+
+START_TEST(truncatedHeader) {
+  for (size_t size = 0; size < HEADER_SIZE; size++) {
+    writeBytes(header, size);
+    ck_assert_ptr_null(openInputLog(path, NULL));
+  }
+}
+END_TEST
+
+START_TEST(invalidHeader) {
+  uint8_t bytes[HEADER_SIZE];
+
+  memcpy(bytes, header, HEADER_SIZE);
+  bytes[0] = 'X';
+  writeBytes(bytes, HEADER_SIZE);
+  ck_assert_ptr_null(openInputLog(path, NULL));
+
+  memcpy(bytes, header, HEADER_SIZE);
+  bytes[4] = INPUT_LOG_VERSION + 1;
+  writeBytes(bytes, HEADER_SIZE);
+  ck_assert_ptr_null(openInputLog(path, NULL));
+
+  // Начальное значение обрезано внутри числа.
+  memcpy(bytes, header, HEADER_SIZE);
+  bytes[5] = 0x81;
+  writeBytes(bytes, HEADER_SIZE);
+  ck_assert_ptr_null(openInputLog(path, NULL));
+}
+END_TEST
+
+START_TEST(truncatedVarint) {
+  static const uint8_t events[] = {0x80, 0x80};
+  InputLogEvent_t event;
+
+  for (size_t size = 1; size <= sizeof(events); size++) {
+    writeLog(events, size);
+    ck_assert_int_eq(readFirstEvent(&event), INPUT_LOG_CORRUPT);
+  }
+}
+END_TEST
+
+// Число длиннее 64 бит: одиннадцать байт или лишние биты десятого байта.
+START_TEST(oversizedVarint) {
+  uint8_t events[VARINT_MAX_BYTES + 1];
+  InputLogEvent_t event;
+
+  memset(events, 0x80, sizeof(events));
+  events[VARINT_MAX_BYTES] = 0x00;
+  writeLog(events, sizeof(events));
+  ck_assert_int_eq(readFirstEvent(&event), INPUT_LOG_CORRUPT);
+
+  memset(events, 0xff, VARINT_MAX_BYTES - 1);
+  events[VARINT_MAX_BYTES - 1] = 0x02;
+  writeLog(events, VARINT_MAX_BYTES);
+  ck_assert_int_eq(readFirstEvent(&event), INPUT_LOG_CORRUPT);
+}
+END_TEST
+
+// Действие Left (код 4) записано двумя байтами вместо одного.
+START_TEST(overlongVarint) {
+  static const uint8_t events[] = {0x84, 0x00};
+  InputLogEvent_t event;
+
+  writeLog(events, sizeof(events));
+  ck_assert_int_eq(readFirstEvent(&event), INPUT_LOG_CORRUPT);
+}
+END_TEST
+
+START_TEST(unknownEventCode) {
+  const uint8_t events[] = {INPUT_LOG_TICK_CODE + 1};
+  InputLogEvent_t event;
+
+  writeLog(events, sizeof(events));
+  ck_assert_int_eq(readFirstEvent(&event), INPUT_LOG_CORRUPT);
+}
+END_TEST
+
+// Сумма интервалов превышает диапазон времени события (int64_t, нс).
+START_TEST(timeOverflow) {
+  const uint64_t maxTime = INT64_MAX / INPUT_LOG_TIME_UNIT;
+  uint8_t events[2 * VARINT_MAX_BYTES];
+  size_t size = encodeVarint(events, maxTime << INPUT_LOG_CODE_BITS |
+                                         INPUT_LOG_TICK_CODE);
+  InputLogEvent_t event;
+
+  size += encodeVarint(events + size,
+                       1u << INPUT_LOG_CODE_BITS | INPUT_LOG_TICK_CODE);
+  writeLog(events, size);
+
+  InputLogReader_t* reader = openInputLog(path, NULL);
+  ck_assert_ptr_nonnull(reader);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_OK);
+  ck_assert_int_eq(event.time, (int64_t)maxTime * INPUT_LOG_TIME_UNIT);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_CORRUPT);
+  closeInputLog(reader);
+}
+END_TEST
+
+START_TEST(cleanEnd) {
+  const uint8_t events[] = {INPUT_LOG_TICK_CODE};
+  InputLogEvent_t event;
+
+  writeLog(events, sizeof(events));
+  InputLogReader_t* reader = openInputLog(path, NULL);
+  ck_assert_ptr_nonnull(reader);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_OK);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_END);
+  ck_assert_int_eq(readInputLogEvent(reader, &event), INPUT_LOG_END);
+  closeInputLog(reader);
+}
+END_TEST
+
+Suite* inputLogSuite(void) {
+  Suite* suite = suite_create("input_log");
+  TCase* tcase = tcase_create("read");
+
+  tcase_add_checked_fixture(tcase, setup, teardown);
+  tcase_add_test(tcase, roundTrip);
+  tcase_add_test(tcase, truncatedHeader);
+  tcase_add_test(tcase, invalidHeader);
+  tcase_add_test(tcase, truncatedVarint);
+  tcase_add_test(tcase, oversizedVarint);
+  tcase_add_test(tcase, overlongVarint);
+  tcase_add_test(tcase, unknownEventCode);
+  tcase_add_test(tcase, timeOverflow);
+  tcase_add_test(tcase, cleanEnd);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file key_repeat_test.c
+ * @brief Тесты распознавания удержания клавиш (key_repeat.h).
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details События ввода подаются по виртуальным часам, таймеры
+ * автоповтора обрабатываются в свои сроки, как в цикле контроллера.
+ * Переданные модели действия читаются из записи сессии (input_log.h):
+ * userInput() записывает каждое действие с признаком удержания и временем.
+ * Повторяемая клавиша выбирается по isRepeatableAction() собранной игры.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../common/input_log.h"
+#include "../../common/key_repeat.h"
+#include "../test.h"
+
+/**
+ * @def MAX_EVENTS
+ * @brief Наибольшее количество действий в записи теста
+ */
+#define MAX_EVENTS 64
+
+/**
+ * @def TERMINAL_DELAY
+ * @brief Задержка автоповтора терминала (меньше holdGap), нс
+ */
+#define TERMINAL_DELAY (60 * NSEC_PER_MSEC)
+
+/**
+ * @def TERMINAL_PERIOD
+ * @brief Период автоповтора терминала, нс
+ */
+#define TERMINAL_PERIOD (30 * NSEC_PER_MSEC)
+
+static char path[] = "/tmp/brick_game_key_repeatXXXXXX";
+static GameContext_t* context;
+static LocatorScope_t* previous;
+static VirtualClock_t clockTime;
+static InputLog_t* inputLog;
+static GameTimerService_t timers;
+static KeyRepeat_t repeat;
+static UserAction_t key;  ///< Повторяемая клавиша игры
+static InputLogEvent_t events[MAX_EVENTS];
+static int count;  ///< Количество действий в events
+
+// Первое действие после `after`, для которого isRepeatableAction() равно
+// `repeatable`.
+static UserAction_t findAction(int after, bool repeatable) {
+  for (int action = after + 1; action <= Action; action++)
+    if (isRepeatableAction((UserAction_t)action) == repeatable)
+      return (UserAction_t)action;
+  return Start;
+}
+
+static void setup(void) {
+  strcpy(path + strlen(path) - 6, "XXXXXX");
+  int fd = mkstemp(path);
+  ck_assert_int_ge(fd, 0);
+  close(fd);
+
+  context = createGameContext(TEST_SEED);
+  ck_assert_ptr_nonnull(context);
+  previous = bindLocatorScope(&context->scope);
+  clockTime.time = 0;
+  GameClock_t clock = virtualGameClock(&clockTime);
+  inputLog = createInputLog(path, TEST_SEED, &clock);
+  ck_assert_ptr_nonnull(inputLog);
+  initTimerService(&timers);
+  initKeyRepeat(&repeat, KEY_DAS_DEFAULT, KEY_ARR_DEFAULT);
+  key = findAction(Start, true);
+  ck_assert_int_ne(key, Start);
+  count = 0;
+}
+
+static void teardown(void) {
+  if (inputLog) destroyInputLog(inputLog);
+  bindLocatorScope(previous);
+  destroyGameContext(context);
+  unlink(path);
+}
+
+// Продвигает часы до `until`, обрабатывая таймеры в их сроки.
+static void runUntil(int64_t until) {
+  for (int64_t wait = timeUntilNextTimer(&timers, clockTime.time);
+       wait >= 0 && clockTime.time + wait <= until;
+       wait = timeUntilNextTimer(&timers, clockTime.time)) {
+    advanceVirtualClock(&clockTime, wait);
+    for (int id = pollExpiredTimer(&timers, clockTime.time); id != TIMER_NONE;
+         id = pollExpiredTimer(&timers, clockTime.time))
+      processKeyTimer(&repeat, &timers, id, clockTime.time);
+  }
+  advanceVirtualClock(&clockTime, until - clockTime.time);
+}
+
+static void press(UserAction_t action, int64_t at) {
+  InputEvent_t event = {at, action, 0};
+
+  runUntil(at);
+  processKeyEvent(&repeat, &timers, &event, at);
+}
+
+// Удержание клавиши: нажатие в `at`, повторы терминала до `until`.
+static void hold(UserAction_t action, int64_t at, int64_t until) {
+  press(action, at);
+  for (int64_t repeatAt = at + TERMINAL_DELAY; repeatAt <= until;
+       repeatAt += TERMINAL_PERIOD)
+    press(action, repeatAt);
+}
+
+// Завершает запись и читает переданные модели действия.
+static void readActions(void) {
+  InputLogEvent_t event;
+
+  ck_assert_int_eq(destroyInputLog(inputLog), 0);
+  inputLog = NULL;
+  InputLogReader_t* reader = openInputLog(path, NULL);
+  ck_assert_ptr_nonnull(reader);
+  while (readInputLogEvent(reader, &event) == INPUT_LOG_OK) {
+    ck_assert_int_lt(count, MAX_EVENTS);
+    if (event.type == INPUT_LOG_ACTION) events[count++] = event;
+  }
+  closeInputLog(reader);
+}
+
+static void assertAction(int index, UserAction_t action, bool held,
+                         int64_t at) {
+  ck_assert_int_lt(index, count);
+  ck_assert_int_eq(events[index].action, action);
+  ck_assert_int_eq(events[index].hold, held);
+  ck_assert_int_eq(events[index].time, at);
+}
+
+START_TEST(singleTap) {
+  press(key, 0);
+  runUntil(NSEC_PER_SEC);
+  readActions();
+
+  ck_assert_int_eq(count, 1);
+  assertAction(0, key, false, 0);
+  ck_assert_int_eq(isTimerActive(&timers, TIMER_DAS), false);
+  ck_assert_int_eq(isTimerActive(&timers, TIMER_ARR), false);
+}
+END_TEST
+
+// Первый повтор терминала не позже holdGap начинает удержание: перемещение
+// через DAS от нажатия, затем через каждые ARR, пока идут повторы.
+START_TEST(holdRepeatsAtDasAndArr) {
+  const int64_t until = 400 * NSEC_PER_MSEC;
+
+  ck_assert_int_le(TERMINAL_DELAY, repeat.holdGap);
+  hold(key, 0, until);
+  ck_assert_int_eq(repeat.held, true);
+  runUntil(until);
+  readActions();
+
+  // Повторы терминала в модель не передаются.
+  int moves = 1 + (int)((until - repeat.das) / repeat.arr);
+  ck_assert_int_eq(count, 1 + moves);
+  assertAction(0, key, false, 0);
+  for (int i = 0; i < moves; i++)
+    assertAction(1 + i, key, true, repeat.das + i * repeat.arr);
+}
+END_TEST
+
+// Без повторов дольше releaseTimeout клавиша отпущена: перемещения
+// прекращаются, таймеры автоповтора остановлены.
+START_TEST(releaseAfterTimeout) {
+  const int64_t until = 400 * NSEC_PER_MSEC;
+
+  hold(key, 0, until);
+  int64_t lastSeen = repeat.lastSeen;
+  runUntil(NSEC_PER_SEC);
+  ck_assert_int_eq(repeat.down, false);
+  ck_assert_int_eq(isTimerActive(&timers, TIMER_DAS), false);
+  ck_assert_int_eq(isTimerActive(&timers, TIMER_ARR), false);
+
+  // Следующее нажатие снова передается сразу.
+  press(key, NSEC_PER_SEC);
+  readActions();
+  for (int i = 0; i < count - 1; i++)
+    ck_assert_int_le(events[i].time, lastSeen + repeat.releaseTimeout);
+  assertAction(count - 1, key, false, NSEC_PER_SEC);
+}
+END_TEST
+
+// Другая повторяемая клавиша — новое нажатие, удержание прерывается.
+// Неповторяемое действие передается сразу и удержание не прерывает.
+START_TEST(interleavedKeys) {
+  UserAction_t other = findAction(key, true);
+  bool repeatable = other != Start;
+  // Перемещение, а не Start, Pause или Terminate.
+  if (!repeatable) other = findAction(Terminate, false);
+  const int64_t step = 30 * NSEC_PER_MSEC;
+
+  for (int i = 0; i < 4; i++) press(i % 2 ? other : key, i * step);
+  ck_assert_int_eq(repeat.held, !repeatable);
+  runUntil(NSEC_PER_SEC);
+  readActions();
+
+  if (repeatable) {
+    ck_assert_int_eq(count, 4);
+    for (int i = 0; i < 4; i++)
+      assertAction(i, i % 2 ? other : key, false, i * step);
+  } else {
+    // Повтор клавиши через 2·step — удержание, отпущенное до DAS.
+    ck_assert_int_eq(count, 3);
+    assertAction(0, key, false, 0);
+    assertAction(1, other, false, step);
+    assertAction(2, other, false, 3 * step);
+  }
+}
+END_TEST
+
+// Нажатия одной клавиши чаще holdGap неотличимы от автоповтора терминала:
+// второе нажатие не передается, удержание отпускается до DAS.
+START_TEST(mergeCloseTaps) {
+  const int64_t nearTap = repeat.holdGap / 2;
+  const int64_t farTap = NSEC_PER_SEC + repeat.holdGap + NSEC_PER_MSEC;
+
+  press(key, 0);
+  press(key, nearTap);
+  press(key, NSEC_PER_SEC);
+  press(key, farTap);
+  runUntil(2 * NSEC_PER_SEC);
+  readActions();
+
+  ck_assert_int_eq(count, 3);
+  assertAction(0, key, false, 0);
+  assertAction(1, key, false, NSEC_PER_SEC);
+  assertAction(2, key, false, farTap);
+}
+END_TEST
+
+Suite* keyRepeatSuite(void) {
+  Suite* suite = suite_create("key_repeat");
+  TCase* tcase = tcase_create("process");
+
+  tcase_add_checked_fixture(tcase, setup, teardown);
+  tcase_add_test(tcase, singleTap);
+  tcase_add_test(tcase, holdRepeatsAtDasAndArr);
+  tcase_add_test(tcase, releaseAfterTimeout);
+  tcase_add_test(tcase, interleavedKeys);
+  tcase_add_test(tcase, mergeCloseTaps);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file leaderboard_test.c
+ * @brief Тесты таблицы рекордов (leaderboard.h).
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Файл таблицы создается submitLeaderboardScore() во временном
+ * каталоге и изменяется по полям LeaderboardFile_t: поврежденный файл
+ * должен читаться как пустая таблица. Изменения таблиц сопровождаются
+ * пересчетом контрольной суммы, чтобы проверялись сами таблицы.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../common/leaderboard.h"
+#include "../test.h"
+
+/**
+ * @def TEST_ENTRIES
+ * @brief Количество результатов Tetris в файле теста
+ */
+#define TEST_ENTRIES 3
+
+static char directory[] = "/tmp/brick_game_leaderboardXXXXXX";
+static char path[sizeof(directory) + 32];
+static LeaderboardFile_t valid;  ///< Содержимое файла в начале теста
+
+static void removeFile(const char* suffix) {
+  char name[sizeof(path) + 8];
+
+  snprintf(name, sizeof(name), "%s%s", path, suffix);
+  unlink(name);
+}
+
+static void writeFile(const LeaderboardFile_t* file, size_t size) {
+  FILE* stream = fopen(path, "wb");
+
+  ck_assert_ptr_nonnull(stream);
+  ck_assert_uint_eq(fwrite(file, 1, size, stream), size);
+  ck_assert_int_eq(fclose(stream), 0);
+}
+
+// Контрольная сумма таблиц FNV-1a, как в файле таблицы.
+static void updateChecksum(LeaderboardFile_t* file) {
+  const unsigned char* bytes = (const unsigned char*)file->tables;
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < sizeof(file->tables); i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  file->checksum = hash;
+}
+
+static void submit(LeaderboardGame game, int32_t score) {
+  LeaderboardEntry_t entry = {score, 1, 0};
+
+  ck_assert_int_eq(submitLeaderboardScore(path, game, &entry), 0);
+}
+
+// Файл читается как пустая таблица обеих игр.
+static void assertEmpty(void) {
+  Leaderboard_t* board = openLeaderboard(path);
+
+  ck_assert_ptr_nonnull(board);
+  for (int game = 0; game < NUM_LEADERBOARD_GAMES; game++) {
+    ck_assert_uint_eq(getLeaderboardTable(board, game)->count, 0);
+    ck_assert_int_eq(getLeaderboardHighScore(board, game), 0);
+  }
+  closeLeaderboard(board);
+}
+
+// Записывает измененную копию `file` с пересчитанной контрольной суммой.
+static void assertRejected(LeaderboardFile_t* file) {
+  updateChecksum(file);
+  writeFile(file, sizeof(*file));
+  assertEmpty();
+}
+
+static void setup(void) {
+  strcpy(directory + strlen(directory) - 6, "XXXXXX");
+  ck_assert_ptr_nonnull(mkdtemp(directory));
+  snprintf(path, sizeof(path), "%s/leaderboard", directory);
+
+  submit(LEADERBOARD_TETRIS, 20);
+  submit(LEADERBOARD_TETRIS, 30);
+  submit(LEADERBOARD_TETRIS, 10);
+  submit(LEADERBOARD_SNAKE, 7);
+
+  FILE* stream = fopen(path, "rb");
+  ck_assert_ptr_nonnull(stream);
+  ck_assert_uint_eq(fread(&valid, 1, sizeof(valid), stream), sizeof(valid));
+  ck_assert_int_eq(fclose(stream), 0);
+}
+
+static void teardown(void) {
+  removeFile("");
+  removeFile(".lock");
+  rmdir(directory);
+}
+
+START_TEST(roundTrip) {
+  static const int32_t scores[TEST_ENTRIES] = {30, 20, 10};
+  Leaderboard_t* board = openLeaderboard(path);
+
+  ck_assert_ptr_nonnull(board);
+  const LeaderboardTable_t* table =
+      getLeaderboardTable(board, LEADERBOARD_TETRIS);
+  ck_assert_uint_eq(table->count, TEST_ENTRIES);
+  for (int i = 0; i < TEST_ENTRIES; i++)
+    ck_assert_int_eq(table->entries[i].score, scores[i]);
+  ck_assert_int_eq(getLeaderboardHighScore(board, LEADERBOARD_SNAKE), 7);
+  closeLeaderboard(board);
+}
+END_TEST
+
+START_TEST(missingFile) {
+  removeFile("");
+  assertEmpty();
+}
+END_TEST
+
+START_TEST(truncated) {
+  static const size_t sizes[] = {0, sizeof(uint32_t),
+                                 offsetof(LeaderboardFile_t, tables),
+                                 sizeof(LeaderboardFile_t) - 1};
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    writeFile(&valid, sizes[i]);
+    assertEmpty();
+  }
+}
+END_TEST
+
+START_TEST(oversized) {
+  unsigned char data[sizeof(LeaderboardFile_t) + 1] = {0};
+
+  memcpy(data, &valid, sizeof(valid));
+  writeFile((const LeaderboardFile_t*)data, sizeof(data));
+  assertEmpty();
+}
+END_TEST
+
+START_TEST(invalidHeader) {
+  LeaderboardFile_t file = valid;
+
+  file.magic ^= 1;
+  assertRejected(&file);
+  file = valid;
+  file.version++;
+  assertRejected(&file);
+  file = valid;
+  file.size--;
+  assertRejected(&file);
+}
+END_TEST
+
+START_TEST(checksumMismatch) {
+  LeaderboardFile_t file = valid;
+
+  file.tables[LEADERBOARD_TETRIS].entries[0].score++;
+  writeFile(&file, sizeof(file));
+  assertEmpty();
+}
+END_TEST
+
+START_TEST(countTooLarge) {
+  LeaderboardFile_t file = valid;
+
+  file.tables[LEADERBOARD_SNAKE].count = LEADERBOARD_SIZE + 1;
+  assertRejected(&file);
+}
+END_TEST
+
+START_TEST(reservedNotZero) {
+  LeaderboardFile_t file = valid;
+
+  file.tables[LEADERBOARD_TETRIS].reserved = 1;
+  assertRejected(&file);
+}
+END_TEST
+
+START_TEST(unsortedEntries) {
+  LeaderboardFile_t file = valid;
+  LeaderboardEntry_t* entries = file.tables[LEADERBOARD_TETRIS].entries;
+  LeaderboardEntry_t first = entries[0];
+
+  entries[0] = entries[TEST_ENTRIES - 1];
+  entries[TEST_ENTRIES - 1] = first;
+  assertRejected(&file);
+}
+END_TEST
+
+// Последняя запись не нарушает порядок, но результат не положителен.
+START_TEST(nonPositiveScore) {
+  static const int32_t scores[] = {0, -1};
+
+  for (size_t i = 0; i < sizeof(scores) / sizeof(scores[0]); i++) {
+    LeaderboardFile_t file = valid;
+    file.tables[LEADERBOARD_TETRIS].entries[TEST_ENTRIES - 1].score =
+        scores[i];
+    assertRejected(&file);
+  }
+}
+END_TEST
+
+// Поврежденный файл при обновлении заменяется таблицей из нового результата.
+START_TEST(submitOverCorrupt) {
+  LeaderboardFile_t file = valid;
+
+  file.checksum ^= 1;
+  writeFile(&file, sizeof(file));
+  submit(LEADERBOARD_SNAKE, 3);
+
+  Leaderboard_t* board = openLeaderboard(path);
+  ck_assert_ptr_nonnull(board);
+  ck_assert_int_eq(getLeaderboardHighScore(board, LEADERBOARD_TETRIS), 0);
+  ck_assert_int_eq(getLeaderboardHighScore(board, LEADERBOARD_SNAKE), 3);
+  closeLeaderboard(board);
+}
+END_TEST
+
+Suite* leaderboardSuite(void) {
+  Suite* suite = suite_create("leaderboard");
+  TCase* tcase = tcase_create("open");
+
+  tcase_add_checked_fixture(tcase, setup, teardown);
+  tcase_add_test(tcase, roundTrip);
+  tcase_add_test(tcase, missingFile);
+  tcase_add_test(tcase, truncated);
+  tcase_add_test(tcase, oversized);
+  tcase_add_test(tcase, invalidHeader);
+  tcase_add_test(tcase, checksumMismatch);
+  tcase_add_test(tcase, countTooLarge);
+  tcase_add_test(tcase, reservedNotZero);
+  tcase_add_test(tcase, unsortedEntries);
+  tcase_add_test(tcase, nonPositiveScore);
+  tcase_add_test(tcase, submitOverCorrupt);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
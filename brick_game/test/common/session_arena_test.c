@@ -0,0 +1,114 @@
+/**
+ * @file session_arena_test.c
+ * @brief Тесты арены памяти игровой сессии (session_arena.h).
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Циклы выделения и освобождения повторяются больше раз, чем
+ * помещается в арену без повторного использования памяти.
+ */
+
+#include "../../common/game_context.h"
+#include "../../common/session_arena.h"
+#include "../test.h"
+
+/**
+ * @def LARGE_SIZE
+ * @brief Размер большого объекта (матрица поля 20x10 на 64-битной машине)
+ */
+#define LARGE_SIZE 960
+
+/**
+ * @def CYCLES
+ * @brief Количество циклов: суммарный объем больше размера арены
+ */
+#define CYCLES (4 * SESSION_ARENA_SIZE / LARGE_SIZE)
+
+static SessionArena_t* arena;
+
+static void setup(void) {
+  arena = createSessionArena(SESSION_ARENA_SIZE);
+  ck_assert_ptr_nonnull(arena);
+}
+
+static void teardown(void) { destroySessionArena(arena); }
+
+// Последний выделенный объект возвращает память арене.
+START_TEST(releaseLastLarge) {
+  void* first = arenaAlloc(arena, LARGE_SIZE);
+
+  ck_assert_ptr_nonnull(first);
+  for (int i = 0; i < CYCLES; i++) {
+    void* block = arenaAlloc(arena, LARGE_SIZE + 1);
+    ck_assert_ptr_nonnull(block);
+    arenaRelease(arena, block, LARGE_SIZE + 1);
+  }
+  arenaRelease(arena, first, LARGE_SIZE);
+  ck_assert_uint_eq(arena->offset, 0);
+}
+END_TEST
+
+// Объект в середине арены используется для объекта того же размера.
+START_TEST(reuseReleasedLarge) {
+  void* block = arenaAlloc(arena, LARGE_SIZE);
+  void* tail = arenaAlloc(arena, ARENA_ALIGNMENT);
+
+  ck_assert_ptr_nonnull(block);
+  ck_assert_ptr_nonnull(tail);
+  for (int i = 0; i < CYCLES; i++) {
+    arenaRelease(arena, block, LARGE_SIZE);
+    ck_assert_ptr_eq(arenaAlloc(arena, LARGE_SIZE), block);
+  }
+
+  // Объект другого размера выделяется из свободной памяти арены.
+  arenaRelease(arena, block, LARGE_SIZE);
+  void* other = arenaAlloc(arena, 2 * LARGE_SIZE);
+  ck_assert_ptr_nonnull(other);
+  ck_assert_ptr_ne(other, block);
+  ck_assert_ptr_eq(arenaAlloc(arena, LARGE_SIZE), block);
+}
+END_TEST
+
+START_TEST(resetForgetsReleased) {
+  void* block = arenaAlloc(arena, LARGE_SIZE);
+
+  ck_assert_ptr_nonnull(arenaAlloc(arena, ARENA_ALIGNMENT));
+  arenaRelease(arena, block, LARGE_SIZE);
+  resetSessionArena(arena);
+  ck_assert_ptr_null(arena->released);
+  ck_assert_ptr_eq(arenaAlloc(arena, LARGE_SIZE), arena->base);
+}
+END_TEST
+
+// Матрица размером с поле создается и удаляется в контексте игры.
+START_TEST(matrixCreateRemove) {
+  GameContext_t* context = createGameContext(TEST_SEED);
+  ck_assert_ptr_nonnull(context);
+  LocatorScope_t* previous = bindLocatorScope(&context->scope);
+
+  for (int i = 0; i < CYCLES; i++) {
+    int** matrix = createMatrix(FIELD_HEIGHT, FIELD_WIDTH);
+    ck_assert_ptr_nonnull(matrix);
+    matrix[FIELD_HEIGHT - 1][FIELD_WIDTH - 1] = i;
+    ck_assert_int_eq(removeMatrix(FIELD_HEIGHT, FIELD_WIDTH, matrix), true);
+  }
+
+  bindLocatorScope(previous);
+  destroyGameContext(context);
+}
+END_TEST
+
+Suite* sessionArenaSuite(void) {
+  Suite* suite = suite_create("session_arena");
+  TCase* tcase = tcase_create("release");
+
+  tcase_add_checked_fixture(tcase, setup, teardown);
+  tcase_add_test(tcase, releaseLastLarge);
+  tcase_add_test(tcase, reuseReleasedLarge);
+  tcase_add_test(tcase, resetForgetsReleased);
+  tcase_add_test(tcase, matrixCreateRemove);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file main.c
+ * @brief Запуск модульных тестов модели BrickGame.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include <stdlib.h>
+
+#include "test.h"
+
+int main(void) {
+  SRunner* runner = srunner_create(gameSnapshotSuite());
+
+  srunner_add_suite(runner, gameTimerSuite());
+  srunner_add_suite(runner, inputLogSuite());
+  srunner_add_suite(runner, keyRepeatSuite());
+  srunner_add_suite(runner, leaderboardSuite());
+  srunner_add_suite(runner, sessionArenaSuite());
+  srunner_run_all(runner, CK_NORMAL);
+  int failed = srunner_ntests_failed(runner);
+  srunner_free(runner);
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
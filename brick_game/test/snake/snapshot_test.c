@@ -0,0 +1,110 @@
+/**
+ * @file snapshot_test.c
+ * @brief Тесты снимка состояния Snake.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Снимок записывается в начале игры (тело из
+ * SNAKE_INITIAL_LENGTH сегментов, snapshot_fixture.c) и изменяется по
+ * смещениям формата (game_snapshot.h): поврежденный снимок должен
+ * отклоняться без изменения модели.
+ */
+
+#include <string.h>
+
+#include "../../snake/snake.h"
+#include "../test.h"
+
+/**
+ * @def BLOCK_SIZE
+ * @brief Размер сегмента тела в снимке
+ */
+#define BLOCK_SIZE 5
+
+/**
+ * @def BODY_OFFSET
+ * @brief Смещение тела от начала данных модели: метка, направления, еда,
+ * длина
+ */
+#define BODY_OFFSET (1 + 2 + 2 + 2)
+
+static size_t body;  ///< Смещение первого сегмента тела в снимке
+
+static void setup(void) {
+  setupSnapshotTest();
+  body = testSnapshotSize - SNAKE_INITIAL_LENGTH * BLOCK_SIZE;
+  ck_assert_uint_eq(
+      testSnapshotSize > BODY_OFFSET + SNAKE_INITIAL_LENGTH * BLOCK_SIZE, 1);
+}
+
+START_TEST(emptyBody) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+  uint16_t length = 0;
+
+  memcpy(data, testSnapshot, testSnapshotSize);
+  memcpy(data + body - sizeof(length), &length, sizeof(length));
+  ck_assert_int_eq(decodeTestSnapshot(data, body), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+// Сегмент совпадает с головой: тело пересекает само себя.
+START_TEST(selfIntersectingBody) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+
+  memcpy(data, testSnapshot, testSnapshotSize);
+  memcpy(data + body + 2 * BLOCK_SIZE, data + body, BLOCK_SIZE);
+  ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+// Хвост перенесен в свободную клетку, не соседнюю с предыдущим сегментом.
+START_TEST(disconnectedBody) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+  size_t tail = body + (SNAKE_INITIAL_LENGTH - 1) * BLOCK_SIZE;
+  int8_t position[2];
+
+  memcpy(data, testSnapshot, testSnapshotSize);
+  memcpy(position, data + tail + 2, sizeof(position));
+  position[0] = (int8_t)(position[0] < FIELD_WIDTH / 2 ? FIELD_WIDTH - 1 : 0);
+  position[1] = (int8_t)(position[1] < FIELD_HEIGHT / 2 ? FIELD_HEIGHT - 1 : 0);
+  memcpy(data + tail + 2, position, sizeof(position));
+  ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+// Текущее или следующее направление ведет из головы в соседний сегмент:
+// в начале игры змейка движется вправо, шея слева от головы.
+START_TEST(directionIntoNeck) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+  size_t directions = body - BODY_OFFSET + 1;
+
+  for (int i = 0; i < 2; i++) {
+    memcpy(data, testSnapshot, testSnapshotSize);
+    data[directions + i] = ToLeft;
+    ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+  }
+  assertModelUnchanged();
+
+  // Поворот вверх не ведет в шею.
+  memcpy(data, testSnapshot, testSnapshotSize);
+  data[directions + 1] = ToTop;
+  ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 0);
+}
+END_TEST
+
+Suite* gameSnapshotSuite(void) {
+  Suite* suite = suite_create("snake_snapshot");
+  TCase* tcase = createSnapshotTestCase(setup);
+
+  tcase_add_test(tcase, emptyBody);
+  tcase_add_test(tcase, selfIntersectingBody);
+  tcase_add_test(tcase, disconnectedBody);
+  tcase_add_test(tcase, directionIntoNeck);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
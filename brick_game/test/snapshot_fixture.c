@@ -0,0 +1,85 @@
+/**
+ * @file snapshot_fixture.c
+ * @brief Общее окружение тестов снимка состояния модели игры.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Снимок записывается в начале игры (STATE_MOVE_DOWN) и
+ * декодируется в контексте игры теста. Случаи, не зависящие от формата
+ * данных модели (полный, обрезанный и слишком длинный снимок), проверяются
+ * здесь; наборы игр добавляют случаи своих данных.
+ */
+
+#include "test.h"
+
+GameContext_t* testContext;
+uint8_t testSnapshot[GAME_SNAPSHOT_MAX_SIZE + 1];
+size_t testSnapshotSize;
+
+static GameTimerService_t timers;
+
+size_t encodeTestSnapshot(uint8_t* data, size_t capacity) {
+  LocatorScope_t* previous = bindLocatorScope(&testContext->scope);
+  size_t length = encodeGameSnapshot(data, capacity, &timers, 0);
+  bindLocatorScope(previous);
+  return length;
+}
+
+int decodeTestSnapshot(const uint8_t* data, size_t length) {
+  LocatorScope_t* previous = bindLocatorScope(&testContext->scope);
+  int error = decodeGameSnapshot(data, length, &timers, 0);
+  bindLocatorScope(previous);
+  return error;
+}
+
+void assertModelUnchanged(void) {
+  uint8_t current[GAME_SNAPSHOT_MAX_SIZE];
+
+  ck_assert_uint_eq(encodeTestSnapshot(current, sizeof(current)),
+                    testSnapshotSize);
+  ck_assert_mem_eq(current, testSnapshot, testSnapshotSize);
+}
+
+void setupSnapshotTest(void) {
+  testContext = createGameContext(TEST_SEED);
+  ck_assert_ptr_nonnull(testContext);
+  initTimerService(&timers);
+  contextUserInput(testContext, Start, false);
+  ck_assert_int_eq(testContext->fsm->currentState, STATE_MOVE_DOWN);
+  testSnapshotSize = encodeTestSnapshot(testSnapshot, GAME_SNAPSHOT_MAX_SIZE);
+  ck_assert_uint_ne(testSnapshotSize, 0);
+}
+
+void teardownSnapshotTest(void) { destroyGameContext(testContext); }
+
+START_TEST(roundTrip) {
+  ck_assert_int_eq(decodeTestSnapshot(testSnapshot, testSnapshotSize), 0);
+  assertModelUnchanged();
+}
+END_TEST
+
+START_TEST(truncated) {
+  for (size_t length = 0; length < testSnapshotSize; length++)
+    ck_assert_int_eq(decodeTestSnapshot(testSnapshot, length), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+START_TEST(oversized) {
+  testSnapshot[testSnapshotSize] = 0;
+  ck_assert_int_eq(decodeTestSnapshot(testSnapshot, testSnapshotSize + 1), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+TCase* createSnapshotTestCase(SFun setup) {
+  TCase* tcase = tcase_create("decode");
+
+  tcase_add_checked_fixture(tcase, setup, teardownSnapshotTest);
+  tcase_add_test(tcase, roundTrip);
+  tcase_add_test(tcase, truncated);
+  tcase_add_test(tcase, oversized);
+
+  return tcase;
+}
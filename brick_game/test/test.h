@@ -0,0 +1,115 @@
+/**
+ * @file test.h
+ * @brief Модульные тесты модели BrickGame (check)
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Наборы тестов разделены на общие для игр (common/) и наборы
+ * модели игры (tetris/, snake/), которые собираются только с библиотекой
+ * своей игры:
+ * @code
+ * make test [project_name=snake]
+ * @endcode
+ * Набор модели игры реализует функцию gameSnapshotSuite() на основе общего
+ * окружения тестов снимка (snapshot_fixture.c).
+ */
+
+#ifndef BRICK_GAME_TEST_H
+#define BRICK_GAME_TEST_H
+
+#include <check.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../common/game_context.h"
+#include "../common/game_snapshot.h"
+
+/**
+ * @def TEST_SEED
+ * @brief Начальное значение генератора модели в тестах
+ */
+#define TEST_SEED 1
+
+/**
+ * @brief Контекст игры теста снимка, создается setupSnapshotTest().
+ */
+extern GameContext_t* testContext;
+
+/**
+ * @brief Снимок, записанный в начале теста (с байтом запаса).
+ */
+extern uint8_t testSnapshot[GAME_SNAPSHOT_MAX_SIZE + 1];
+
+/**
+ * @brief Размер снимка testSnapshot.
+ */
+extern size_t testSnapshotSize;
+
+/**
+ * @brief Записывает снимок модели testContext.
+ * @return Размер снимка, 0 при ошибке.
+ */
+size_t encodeTestSnapshot(uint8_t* data, size_t capacity);
+
+/**
+ * @brief Восстанавливает модель testContext из снимка.
+ * @return 0 в случае успеха, 1 если снимок отклонен.
+ */
+int decodeTestSnapshot(const uint8_t* data, size_t length);
+
+/**
+ * @brief Проверяет, что модель не изменилась: ее снимок совпадает с
+ * testSnapshot.
+ */
+void assertModelUnchanged(void);
+
+/**
+ * @brief Создает контекст, начинает игру и записывает testSnapshot.
+ * @details Окружение набора игры вызывает эту функцию первой.
+ */
+void setupSnapshotTest(void);
+
+/**
+ * @brief Уничтожает контекст теста снимка.
+ */
+void teardownSnapshotTest(void);
+
+/**
+ * @brief Создает группу тестов снимка с окружением `setup` и общими
+ * случаями: полный, обрезанный и слишком длинный снимок.
+ */
+TCase* createSnapshotTestCase(SFun setup);
+
+/**
+ * @brief Набор тестов снимка состояния модели игры (game_snapshot.h).
+ */
+Suite* gameSnapshotSuite(void);
+
+/**
+ * @brief Набор тестов службы таймеров (game_timer.h).
+ */
+Suite* gameTimerSuite(void);
+
+/**
+ * @brief Набор тестов чтения записи сессии (input_log.h).
+ */
+Suite* inputLogSuite(void);
+
+/**
+ * @brief Набор тестов чтения файла таблицы рекордов (leaderboard.h).
+ */
+Suite* leaderboardSuite(void);
+
+/**
+ * @brief Набор тестов распознавания удержания клавиш (key_repeat.h).
+ */
+Suite* keyRepeatSuite(void);
+
+/**
+ * @brief Набор тестов повторного использования памяти арены
+ * (session_arena.h).
+ */
+Suite* sessionArenaSuite(void);
+
+#endif
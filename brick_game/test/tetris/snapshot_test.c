@@ -0,0 +1,108 @@
+/**
+ * @file snapshot_test.c
+ * @brief Тесты снимка состояния Tetris.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Снимок записывается в начале игры (STATE_MOVE_DOWN, очередь из
+ * следующей и текущей фигуры, snapshot_fixture.c) и изменяется по
+ * смещениям формата (game_snapshot.h): поврежденный снимок должен
+ * отклоняться без изменения модели.
+ */
+
+#include <string.h>
+
+#include "../../tetris/tetromino.h"
+#include "../test.h"
+
+/**
+ * @def STATE_OFFSET
+ * @brief Смещение состояния автомата: сигнатура, версия, генератор
+ */
+#define STATE_OFFSET (4 + 1 + 8)
+
+/**
+ * @def MODEL_SIZE
+ * @brief Размер данных модели: метка, количество фигур и две фигуры
+ */
+#define MODEL_SIZE (1 + 1 + 2 * 5)
+
+/**
+ * @def BLOCK_SIZE
+ * @brief Размер игрового блока в снимке
+ */
+#define BLOCK_SIZE 5
+
+static void setup(void) {
+  setupSnapshotTest();
+  ck_assert_uint_eq(testSnapshotSize > MODEL_SIZE, 1);
+}
+
+// Очередь из одной фигуры или пустая: текущей фигуры нет.
+START_TEST(partialQueue) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+  size_t count = testSnapshotSize - MODEL_SIZE + 1;
+
+  for (int pieces = 0; pieces < 2; pieces++) {
+    memcpy(data, testSnapshot, testSnapshotSize);
+    data[count] = (uint8_t)pieces;
+    size_t length = testSnapshotSize - (2 - pieces) * BLOCK_SIZE;
+    ck_assert_int_eq(decodeTestSnapshot(data, length), 1);
+  }
+  memcpy(data, testSnapshot, testSnapshotSize);
+  data[count] = 3;
+  ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+START_TEST(invalidPieceType) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+
+  memcpy(data, testSnapshot, testSnapshotSize);
+  data[testSnapshotSize - BLOCK_SIZE] = NUM_TETROMINOES;
+  ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+  assertModelUnchanged();
+}
+END_TEST
+
+// Текущая фигура пересекается с занятыми клетками поля снимка.
+START_TEST(pieceOverlapsField) {
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+
+  for (int y = 0; y < FIELD_HEIGHT; y++)
+    for (int x = 0; x < FIELD_WIDTH; x++)
+      setFieldCell(testContext->field, x, y, 1);
+  ck_assert_uint_eq(encodeTestSnapshot(data, sizeof(data)), testSnapshotSize);
+  ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+}
+END_TEST
+
+// Снимок сохраняется только во время игры.
+START_TEST(stateNotInPlay) {
+  static const uint8_t states[] = {STATE_IDLE, STATE_START, STATE_GAME_OVER,
+                                   STATE_TERMINATE, NUM_STATES};
+  uint8_t data[GAME_SNAPSHOT_MAX_SIZE];
+
+  for (size_t i = 0; i < sizeof(states); i++) {
+    memcpy(data, testSnapshot, testSnapshotSize);
+    data[STATE_OFFSET] = states[i];
+    ck_assert_int_eq(decodeTestSnapshot(data, testSnapshotSize), 1);
+  }
+  assertModelUnchanged();
+}
+END_TEST
+
+Suite* gameSnapshotSuite(void) {
+  Suite* suite = suite_create("tetris_snapshot");
+  TCase* tcase = createSnapshotTestCase(setup);
+
+  tcase_add_test(tcase, partialQueue);
+  tcase_add_test(tcase, invalidPieceType);
+  tcase_add_test(tcase, pieceOverlapsField);
+  tcase_add_test(tcase, stateNotInPlay);
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file autoplayer.c
+ * @brief Реализация автоматического игрока Tetris.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Функции игрока вызываются в потоке игрового цикла. Задачи поиска
+ * выполняются в потоках пула и не обращаются к локаторам: поле и фигуры
+ * передаются им в контексте поиска.
+ */
+
+#include "autoplayer.h"
+
+#include <stdlib.h>
+
+#include "../common/work_pool.h"
+
+/**
+ * @brief Веса признаков оценки поля (Yiyuan Lee, "Tetris AI").
+ */
+#define WEIGHT_HEIGHT (-0.510066)
+#define WEIGHT_LINES 0.760666
+#define WEIGHT_HOLES (-0.35663)
+#define WEIGHT_BUMPINESS (-0.184483)
+
+/**
+ * @def SCORE_LOSS
+ * @brief Оценка размещения, после которого следующая фигура не появляется
+ */
+#define SCORE_LOSS (-1e9)
+
+/**
+ * @struct Placement_t
+ * @brief Размещение фигуры: ход и положение после падения до упора.
+ */
+typedef struct Placement_t {
+  int rotations;        ///< Количество поворотов
+  int shift;            ///< Сдвиг по горизонтали
+  GameBlock_t landing;  ///< Положение после падения
+} Placement_t;
+
+/**
+ * @struct Search_t
+ * @brief Контекст пакета задач поиска (одна задача — одно размещение).
+ */
+typedef struct Search_t {
+  const GameField_t* field;       ///< Поле без текущей фигуры
+  const Placement_t* placements;  ///< Размещения текущей фигуры
+  double* scores;                 ///< Оценки размещений
+  int next;                       ///< Вид следующей фигуры
+  bool lookahead;                 ///< Учитывать следующую фигуру
+} Search_t;
+
+struct Autoplayer_t {
+  WorkPool_t* pool;        ///< Пул потоков поиска
+  bool lookahead;          ///< Учитывать следующую фигуру
+  bool planned;            ///< Ход для фигуры lastPiece передан модели
+  unsigned long lastPiece;  ///< Номер фигуры последнего хода
+  Placement_t placements[TETRIS_MAX_PLACEMENTS];  ///< Размещения фигуры
+  double scores[TETRIS_MAX_PLACEMENTS];           ///< Оценки размещений
+};
+
+static int countBits(unsigned int mask) {
+  int count = 0;
+
+  for (; mask; mask &= mask - 1) ++count;
+
+  return count;
+}
+
+static void dropBlock(const GameField_t* field, GameBlock_t* block) {
+  while (tetrominoFits(field, block->type, block->orientation, block->posX,
+                       block->posY + 1))
+    ++block->posY;
+}
+
+static bool isSamePlacement(const GameBlock_t* a, const GameBlock_t* b) {
+  return a->posX == b->posX && a->posY == b->posY &&
+         getTetrominoShape(a->type, a->orientation) ==
+             getTetrominoShape(b->type, b->orientation);
+}
+
+static void addPlacement(const GameField_t* field, Placement_t* placements,
+                         int* count, GameBlock_t block, int rotations,
+                         int shift) {
+  dropBlock(field, &block);
+  for (int i = 0; i < *count; i++)
+    if (isSamePlacement(&placements[i].landing, &block)) return;
+
+  if (*count < TETRIS_MAX_PLACEMENTS)
+    placements[(*count)++] = (Placement_t){rotations, shift, block};
+}
+
+/*
+ * Перебирает размещения в порядке действий модели: повороты по часовой
+ * стрелке от текущего положения, затем сдвиги до упора влево и вправо.
+ * Одинаковые положения после падения (например, симметричные ориентации)
+ * учитываются один раз — с наименьшим количеством действий.
+ */
+static int findPlacements(const GameField_t* field, GameBlock_t block,
+                          Placement_t* placements) {
+  int count = 0;
+
+  for (int rotations = 0; rotations < NUM_ORIENTATIONS; rotations++) {
+    if (rotations > 0 && rotateTetromino(field, &block, ROTATE_CLOCKWISE))
+      break;
+
+    addPlacement(field, placements, &count, block, rotations, 0);
+    for (int step = -1; step <= 1; step += 2) {
+      GameBlock_t moved = block;
+      int shift = 0;
+      while (tetrominoFits(field, moved.type, moved.orientation,
+                           moved.posX + step, moved.posY)) {
+        moved.posX += step;
+        shift += step;
+        addPlacement(field, placements, &count, moved, rotations, shift);
+      }
+    }
+  }
+
+  return count;
+}
+
+static int placeBlock(GameField_t* field, const GameBlock_t* block) {
+  FieldRow_t rows[TETROMINO_SIZE];
+
+  getTetrominoRows(block->type, block->orientation, rows);
+  placeFieldShape(field, rows, TETROMINO_SIZE, block->posX, block->posY,
+                  block->type + 1);
+
+  return clearFullFieldRows(field);
+}
+
+/*
+ * Признаки вычисляются за один проход по строкам сверху вниз: маска covered
+ * содержит столбцы, занятые в строках выше, поэтому свободные клетки строки
+ * под covered — дыры, а первая занятая клетка столбца задает его высоту.
+ */
+static double evaluateField(const GameField_t* field, int lines) {
+  unsigned int play = ~(unsigned int)field->emptyRow & FIELD_FULL_ROW;
+  unsigned int covered = 0;
+  int heights[FIELD_WIDTH] = {0};
+  int holes = 0;
+
+  for (int y = 0; y < field->height; y++) {
+    unsigned int row = field->rows[y] & play;
+    holes += countBits(~row & covered & play);
+
+    unsigned int top = row & ~covered;
+    for (int x = 0; top && x < field->width; x++)
+      if (top >> (x + FIELD_WALL_OFFSET) & 1u) heights[x] = field->height - y;
+    covered |= row;
+  }
+
+  int height = 0;
+  int bumpiness = 0;
+  for (int x = 0; x < field->width; x++) {
+    height += heights[x];
+    if (x > 0) bumpiness += abs(heights[x] - heights[x - 1]);
+  }
+
+  return WEIGHT_HEIGHT * height + WEIGHT_LINES * lines +
+         WEIGHT_HOLES * holes + WEIGHT_BUMPINESS * bumpiness;
+}
+
+static double evaluateNext(const GameField_t* field, int type, int lines) {
+  Placement_t placements[TETRIS_MAX_PLACEMENTS];
+  GameBlock_t block;
+
+  spawnTetromino(&block, type);
+  if (!tetrominoFits(field, block.type, block.orientation, block.posX,
+                     block.posY))
+    return SCORE_LOSS;
+
+  double best = SCORE_LOSS;
+  int count = findPlacements(field, block, placements);
+  for (int i = 0; i < count; i++) {
+    GameField_t after = *field;
+    int cleared = placeBlock(&after, &placements[i].landing);
+    double score = evaluateField(&after, lines + cleared);
+    if (score > best) best = score;
+  }
+
+  return best;
+}
+
+static void evaluatePlacement(void* context, int index) {
+  Search_t* search = (Search_t*)context;
+  GameField_t after = *search->field;
+  int lines = placeBlock(&after, &search->placements[index].landing);
+
+  search->scores[index] = search->lookahead
+                              ? evaluateNext(&after, search->next, lines)
+                              : evaluateField(&after, lines);
+}
+
+Autoplayer_t* createAutoplayer(int threads) {
+  Autoplayer_t* player = calloc(1, sizeof(Autoplayer_t));
+  if (!player) return NULL;
+
+  player->pool = createWorkPool(threads);
+  player->lookahead = true;
+  if (!player->pool) {
+    free(player);
+    player = NULL;
+  }
+
+  return player;
+}
+
+void destroyAutoplayer(Autoplayer_t* player) {
+  if (!player) return;
+
+  destroyWorkPool(player->pool);
+  free(player);
+}
+
+void setTetrisLookahead(Autoplayer_t* player, bool lookahead) {
+  if (player) player->lookahead = lookahead;
+}
+
+int planTetrisMove(Autoplayer_t* player, TetrisMove_t* move) {
+  FiniteStateMachine* fsm = locateFSM(NULL);
+  GameBlockQueue_t* pieces = locateGameBlockQueue(NULL);
+  GameField_t* field = locateGameField(NULL);
+
+  if (!player || !move || !fsm || !pieces || !field || pieces->size < 2 ||
+      fsm->currentState != STATE_MOVE_DOWN)
+    return 1;
+
+  GameBlock_t* current = getGameBlock(pieces, pieces->size - 1);
+  int count = findPlacements(field, *current, player->placements);
+  Search_t search = {field, player->placements, player->scores,
+                     getGameBlock(pieces, 0)->type, player->lookahead};
+  if (count == 0 ||
+      runWorkPool(player->pool, evaluatePlacement, &search, count))
+    return 1;
+
+  int best = 0;
+  for (int i = 1; i < count; i++)
+    if (player->scores[i] > player->scores[best]) best = i;
+
+  *move = (TetrisMove_t){player->placements[best].rotations,
+                         player->placements[best].shift,
+                         player->placements[best].landing,
+                         player->scores[best]};
+
+  return 0;
+}
+
+int autoplayMove(Autoplayer_t* player) {
+  TetrisMove_t move;
+  int actions = 0;
+
+  if (!player || (player->planned &&
+                  player->lastPiece == getGameCounters()->pieces) ||
+      planTetrisMove(player, &move))
+    return 0;
+
+  player->planned = true;
+  player->lastPiece = getGameCounters()->pieces;
+  for (int i = 0; i < move.rotations; i++, actions++) userInput(Action, false);
+  for (int i = 0; i < abs(move.shift); i++, actions++)
+    userInput(move.shift < 0 ? Left : Right, false);
+  userInput(Up, false);
+
+  return actions + 1;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file autoplayer.h
+ * @brief Автоматический игрок Tetris
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль реализует интерфейс автоматического игрока
+ * (common/autoplayer.h) для Tetris поиском размещения фигуры:
+ *          - для текущей фигуры перебираются все размещения, достижимые
+ *            последовательностью действий "повороты (Action) — сдвиги (Left,
+ *            Right) — падение до упора (Up)" из текущего положения фигуры,
+ *            для каждой из 4 ориентаций (gameBlockOrientation) и каждого
+ *            столбца. Повороты и сдвиги проверяются теми же функциями, что
+ *            и в модели (rotateTetromino(), tetrominoFits()), поэтому
+ *            найденная последовательность действий приводит фигуру ровно в
+ *            найденное положение;
+ *          - с просмотром следующей фигуры (GameInfo_t::next) оценка
+ *            размещения — лучшая оценка поля после размещения обеих фигур;
+ *          - поле оценивается взвешенной суммой: совокупная высота столбцов,
+ *            удаленные строки, дыры (свободные клетки под занятыми) и
+ *            неровность (сумма разностей высот соседних столбцов). Признаки
+ *            вычисляются по маскам строк битового поля (GameField_t).
+ *
+ * Размещения текущей фигуры оцениваются параллельно в пуле потоков с
+ * перехватом работы (work_pool.h): каждая задача — одно размещение текущей
+ * фигуры вместе с перебором размещений следующей. Лучшее размещение
+ * выбирается по наибольшей оценке, а при равенстве — по меньшему номеру в
+ * порядке перебора, поэтому ход не зависит от количества потоков.
+ *
+ * Ход выбирается один раз для каждой новой фигуры и передается модели
+ * сразу целиком: повороты, сдвиги и падение до упора (userInput()).
+ */
+
+#ifndef TETRIS_AUTOPLAYER_H
+#define TETRIS_AUTOPLAYER_H
+
+#include <stdbool.h>
+
+#include "../common/autoplayer.h"
+#include "tetris.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def TETRIS_MAX_PLACEMENTS
+ * @brief Максимальное количество различных размещений одной фигуры
+ */
+#define TETRIS_MAX_PLACEMENTS 64
+
+/**
+ * @struct TetrisMove_t
+ * @brief Ход автоматического игрока.
+ */
+typedef struct TetrisMove_t {
+  int rotations;        ///< Количество поворотов по часовой стрелке (Action)
+  int shift;            ///< Сдвиг: меньше 0 — Left, больше 0 — Right
+  GameBlock_t landing;  ///< Положение фигуры после падения до упора
+  double score;         ///< Оценка хода
+} TetrisMove_t;
+
+/**
+ * @ingroup AutoplayerRoutines
+ * @brief Включает или отключает просмотр следующей фигуры (по умолчанию
+ * включен).
+ */
+void setTetrisLookahead(Autoplayer_t* player, bool lookahead);
+
+/**
+ * @ingroup AutoplayerRoutines
+ * @brief Выбирает ход для текущей фигуры, не передавая его модели.
+ * @return 0 в случае успеха, 1 если фигура не падает (состояние автомата
+ * отлично от STATE_MOVE_DOWN) или при ошибке параметров.
+ */
+int planTetrisMove(Autoplayer_t* player, TetrisMove_t* move);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,5 +1,320 @@
+/**
+ * @file tetris.c
+ * @brief Реализация модели игры Tetris.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @warning Все функции не потокобезопасны. Используйте в однопоточных
+ * приложениях.
+ */
+
 #include "tetris.h"
 
-void onIdleEnter(void* context) {
+#include "../common/game_snapshot.h"
+
+/**
+ * @def TETRIS_SNAPSHOT_TAG
+ * @brief Признак данных модели Tetris в снимке состояния
+ */
+#define TETRIS_SNAPSHOT_TAG 'T'
+
+/**
+ * @brief Очки за одновременно удаленные строки (1, 2, 3, 4 строки).
+ */
+static const int lineScores[] = {0, 100, 300, 700, 1500};
+
+static GameBlock_t* currentPiece() {
+  GameBlockQueue_t* pieces = locateGameBlockQueue(NULL);
+  return getGameBlock(pieces, pieces->size - 1);
+}
+
+static bool pieceFits(const GameBlock_t* piece, int dx, int dy) {
+  return tetrominoFits(locateGameField(NULL), piece->type, piece->orientation,
+                       piece->posX + dx, piece->posY + dy);
+}
+
+static int randomTetromino() {
+  return (int)(gameRandom() % NUM_TETROMINOES);
+}
+
+static void resumeFalling() {
+  fsm_processTrigger(locateFSM(NULL), TRIGGER_RESUME);
+}
+
+static void onStartEnter(void* context) {
+  GameInfo_t* info = (GameInfo_t*)context;
+  GameBlockQueue_t* pieces = locateGameBlockQueue(NULL);
+  GameBlock_t next;
+
+  clearGameField(locateGameField(NULL));
+  populateGameBlockQueue(pieces);
+  initGameBlock(&next, 0, 0, TETROMINO_SIZE, ToTop, randomTetromino());
+  insertGameBlock(pieces, &next);
+
+  info->score = 0;
+  info->level = 1;
+  info->speed = 1;
+  info->pause = 0;
+
+  fsm_processTrigger(locateFSM(NULL), TRIGGER_SPAWN);
+}
+
+static void onSpawnEnter(void* context) {
+  GameInfo_t* info = (GameInfo_t*)context;
+  GameBlockQueue_t* pieces = locateGameBlockQueue(NULL);
+  GameBlock_t next;
+
+  if (pieces->size > 1) popBackGameBlock(pieces, NULL);
+  GameBlock_t* current = currentPiece();
+  spawnTetromino(current, current->type);
+  ++getGameCounters()->pieces;
+  bool fits = pieceFits(current, 0, 0);
+
+  initGameBlock(&next, 0, 0, TETROMINO_SIZE, ToTop, randomTetromino());
+  insertGameBlock(pieces, &next);
+  tetrominoToMatrix(next.type, ToTop, info->next);
+
+  fsm_processTrigger(locateFSM(NULL),
+                     fits ? TRIGGER_MOVE_DOWN : TRIGGER_GAME_OVER);
+}
+
+static void onMoveDownUpdate(void* context) {
+  (void)context;
+  GameBlock_t* current = currentPiece();
+
+  if (pieceFits(current, 0, 1)) {
+    ++current->posY;
+  } else {
+    fsm_processTrigger(locateFSM(NULL), TRIGGER_COLLISION);
+  }
+}
+
+static void onSoftDrop(void* context) {
+  (void)context;
+  GameBlock_t* current = currentPiece();
+
+  if (pieceFits(current, 0, 1)) ++current->posY;
+}
+
+static void onMoveLeftEnter(void* context) {
+  (void)context;
+  GameBlock_t* current = currentPiece();
+
+  if (pieceFits(current, -1, 0)) --current->posX;
+  resumeFalling();
+}
+
+static void onMoveRightEnter(void* context) {
+  (void)context;
+  GameBlock_t* current = currentPiece();
+
+  if (pieceFits(current, 1, 0)) ++current->posX;
+  resumeFalling();
+}
+
+static void onRotateEnter(void* context) {
+  (void)context;
+
+  rotateTetromino(locateGameField(NULL), currentPiece(), ROTATE_CLOCKWISE);
+  resumeFalling();
+}
+
+static void onMoveUpEnter(void* context) {
+  (void)context;
+  GameBlock_t* current = currentPiece();
+
+  while (pieceFits(current, 0, 1)) ++current->posY;
+  fsm_processTrigger(locateFSM(NULL), TRIGGER_COLLISION);
+}
+
+static void onFixFigure(void* context) {
+  GameInfo_t* info = (GameInfo_t*)context;
+  GameField_t* field = locateGameField(NULL);
+  GameBlock_t* current = currentPiece();
+  FieldRow_t rows[TETROMINO_SIZE];
+
+  getTetrominoRows(current->type, current->orientation, rows);
+  placeFieldShape(field, rows, TETROMINO_SIZE, current->posX, current->posY,
+                  current->type + 1);
+
+  int cleared = clearFullFieldRows(field);
+  if (cleared > 0) {
+    getGameCounters()->lines += cleared;
+    info->score += lineScores[cleared];
+    if (info->score > info->high_score) info->high_score = info->score;
+    info->level = 1 + info->score / TETRIS_LEVEL_SCORE;
+    if (info->level > TETRIS_MAX_LEVEL) info->level = TETRIS_MAX_LEVEL;
+    info->speed = info->level;
+  }
+}
+
+static void onPauseEnter(void* context) { ((GameInfo_t*)context)->pause = 1; }
+
+static void onPauseExit(void* context) { ((GameInfo_t*)context)->pause = 0; }
+
+static void onGameOverEnter(void* context) {
+  GameInfo_t* info = (GameInfo_t*)context;
+
+  if (info->score > info->high_score) info->high_score = info->score;
+  ++getGameCounters()->games;
+}
+
+static const Transition idleTransitions[] = {
+    {TRIGGER_START_GAME, STATE_START, NULL},  // Старт игры
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}  // Выход из приложения
+};
+
+static const Transition startTransitions[] = {
+    {TRIGGER_SPAWN, STATE_SPAWN, NULL},  // Переход к генерации фигуры
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition spawnTransitions[] = {
+    {TRIGGER_MOVE_DOWN, STATE_MOVE_DOWN, NULL},  // Начать движение вниз
+    {TRIGGER_GAME_OVER, STATE_GAME_OVER, NULL},  // Фигура не помещается
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition moveDownTransitions[] = {
+    {TRIGGER_ROTATE, STATE_ROTATE, NULL},            // Вращение
+    {TRIGGER_MOVE_LEFT, STATE_MOVE_LEFT, NULL},      // Движение влево
+    {TRIGGER_MOVE_RIGHT, STATE_MOVE_RIGHT, NULL},    // Движение вправо
+    {TRIGGER_MOVE_DOWN, STATE_MOVE_DOWN, onSoftDrop},  // Ускорение падения
+    {TRIGGER_MOVE_UP, STATE_MOVE_UP, NULL},          // Падение до упора
+    {TRIGGER_PAUSE, STATE_PAUSE, NULL},              // Пауза
+    {TRIGGER_COLLISION, STATE_SPAWN, onFixFigure},   // Фиксация фигуры
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition moveUpTransitions[] = {
+    {TRIGGER_COLLISION, STATE_SPAWN, onFixFigure}};
+
+static const Transition resumeTransitions[] = {
+    {TRIGGER_RESUME, STATE_MOVE_DOWN, NULL}};  // Возврат к движению
+
+static const Transition pauseTransitions[] = {
+    {TRIGGER_PAUSE, STATE_MOVE_DOWN, NULL},   // Повторное нажатие паузы
+    {TRIGGER_RESUME, STATE_MOVE_DOWN, NULL},  // Продолжить игру
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+static const Transition gameOverTransitions[] = {
+    {TRIGGER_START_GAME, STATE_START, NULL},  // Рестарт
+    {TRIGGER_INIT, STATE_START, NULL},        // Рестарт
+    {TRIGGER_EXIT, STATE_IDLE, NULL},         // Выход
+    {TRIGGER_TERMINATE, STATE_TERMINATE, NULL}};
+
+const FSMState gameStates[NUM_STATES] = {
+    [STATE_IDLE] = {.id = STATE_IDLE, FSM_TRANSITIONS(idleTransitions)},
+    [STATE_START] = {.id = STATE_START,
+                     .onEnter = onStartEnter,  // Инициализация игры
+                     FSM_TRANSITIONS(startTransitions)},
+    [STATE_TERMINATE] = {.id = STATE_TERMINATE},
+    [STATE_SPAWN] = {.id = STATE_SPAWN,
+                     .onEnter = onSpawnEnter,  // Создать новую фигуру
+                     FSM_TRANSITIONS(spawnTransitions)},
+    [STATE_MOVE_DOWN] = {.id = STATE_MOVE_DOWN,
+                         .onUpdate = onMoveDownUpdate,  // Падение по таймеру
+                         FSM_TRANSITIONS(moveDownTransitions)},
+    [STATE_MOVE_UP] = {.id = STATE_MOVE_UP,
+                       .onEnter = onMoveUpEnter,
+                       FSM_TRANSITIONS(moveUpTransitions)},
+    [STATE_MOVE_LEFT] = {.id = STATE_MOVE_LEFT,
+                         .onEnter = onMoveLeftEnter,
+                         FSM_TRANSITIONS(resumeTransitions)},
+    [STATE_MOVE_RIGHT] = {.id = STATE_MOVE_RIGHT,
+                          .onEnter = onMoveRightEnter,
+                          FSM_TRANSITIONS(resumeTransitions)},
+    [STATE_ROTATE] = {.id = STATE_ROTATE,
+                      .onEnter = onRotateEnter,  // Поворот фигуры
+                      FSM_TRANSITIONS(resumeTransitions)},
+    [STATE_PAUSE] = {.id = STATE_PAUSE,
+                     .onEnter = onPauseEnter,
+                     .onExit = onPauseExit,
+                     FSM_TRANSITIONS(pauseTransitions)},
+    [STATE_GAME_OVER] = {.id = STATE_GAME_OVER,
+                         .onEnter = onGameOverEnter,  // Показать результат
+                         FSM_TRANSITIONS(gameOverTransitions)}};
+
+_Static_assert(FSM_ARRAY_SIZE(gameStates) == NUM_STATES,
+               "Tetris state table must describe every StateID");
+
+bool isRepeatableAction(UserAction_t action) {
+  // Up — мгновенное падение: повтор сбросил бы следующую фигуру.
+  return action == Left || action == Right || action == Down;
+}
+
+int createGameModel() {
+  // Tetris использует только общие ресурсы сессии (поле и очередь блоков).
+  return locateGameField(NULL) && locateGameBlockQueue(NULL) ? 0 : 1;
+}
+
+void destroyGameModel() {}
+
+void encodeGameModel(SnapshotWriter_t* writer) {
+  GameBlockQueue_t* pieces = locateGameBlockQueue(NULL);
+  uint8_t tag = TETRIS_SNAPSHOT_TAG;
+  uint8_t count = (uint8_t)pieces->size;
+
+  WRITE_SNAPSHOT_VALUE(writer, tag);
+  WRITE_SNAPSHOT_VALUE(writer, count);
+  for (int i = 0; i < pieces->size; i++)
+    writeSnapshotBlock(writer, getGameBlock(pieces, i));
+}
+
+static bool isValidPiece(const GameBlock_t* piece) {
+  return piece->type >= 0 && piece->type < NUM_TETROMINOES &&
+         piece->size == TETROMINO_SIZE && piece->posX > -TETROMINO_SIZE &&
+         piece->posX < FIELD_WIDTH && piece->posY > -TETROMINO_SIZE &&
+         piece->posY < FIELD_HEIGHT;
+}
+
+int decodeGameModel(SnapshotReader_t* reader, const GameField_t* field) {
+  // Во время игры очередь хранит следующую и текущую (последнюю) фигуры.
+  GameBlock_t saved[2];
+  uint8_t tag = 0;
+  uint8_t count = 0;
+
+  READ_SNAPSHOT_VALUE(reader, tag);
+  READ_SNAPSHOT_VALUE(reader, count);
+  if (reader->failed || tag != TETRIS_SNAPSHOT_TAG || count != 2) return 1;
+  for (int i = 0; i < count; i++) {
+    readSnapshotBlock(reader, &saved[i]);
+    if (!reader->failed && !isValidPiece(&saved[i])) return 1;
+  }
+  if (reader->failed || reader->position != reader->size) return 1;
+
+  const GameBlock_t* current = &saved[count - 1];
+  if (!tetrominoFits(field, current->type, current->orientation,
+                     current->posX, current->posY))
+    return 1;
+
+  GameBlockQueue_t* pieces = locateGameBlockQueue(NULL);
+  populateGameBlockQueue(pieces);
+  for (int i = 0; i < count; i++) pushBackGameBlock(pieces, &saved[i]);
+
+  return 0;
+}
+
+GameInfo_t updateCurrentState() {
+  GameInfo_t gameinfo = {0};
+  GameInfo_t* current = locateGameInfo(NULL);
+  FiniteStateMachine* fsm = locateFSM(NULL);
+
+  if (current) {
+    gameinfo = *current;
+    fieldToMatrix(locateGameField(NULL), gameinfo.field);
+    if (fsm && (fsm->currentState == STATE_MOVE_DOWN ||
+                fsm->currentState == STATE_PAUSE)) {
+      GameBlock_t* piece = currentPiece();
+      TetrominoShape_t shape = getTetrominoShape(piece->type,
+                                                 piece->orientation);
+      for (int i = 0; i < TETROMINO_SIZE * TETROMINO_SIZE; i++) {
+        int x = piece->posX + i % TETROMINO_SIZE;
+        int y = piece->posY + i / TETROMINO_SIZE;
+        if ((shape >> i) & 1u && x >= 0 && x < FIELD_WIDTH && y >= 0 &&
+            y < FIELD_HEIGHT)
+          gameinfo.field[y][x] = piece->type + 1;
+      }
+    }
+  }
 
+  return gameinfo;
 }
@@ -0,0 +1,210 @@
+/**
+ * @file tetromino.c
+ * @brief Реализация таблиц и функций работы с фигурами игры Tetris.
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ */
+
+#include "tetromino.h"
+
+/**
+ * @brief Упаковка строки матрицы фигуры (1 — клетка занята).
+ */
+#define ROW(a, b, c, d) ((a) | (b) << 1 | (c) << 2 | (d) << 3)
+
+/**
+ * @brief Упаковка матрицы фигуры 4x4 из четырех строк.
+ */
+#define SHAPE(r0, r1, r2, r3) \
+  ((TetrominoShape_t)((r0) | (r1) << 4 | (r2) << 8 | (r3) << 12))
+
+/**
+ * @brief Фигуры в ориентациях ToTop, ToRight, ToBottom, ToLeft (система SRS).
+ */
+static const TetrominoShape_t shapes[NUM_TETROMINOES][NUM_ORIENTATIONS] = {
+    [TETROMINO_I] = {SHAPE(ROW(0, 0, 0, 0), ROW(1, 1, 1, 1), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 1, 0), ROW(0, 0, 1, 0), ROW(0, 0, 1, 0),
+                           ROW(0, 0, 1, 0)),
+                     SHAPE(ROW(0, 0, 0, 0), ROW(0, 0, 0, 0), ROW(1, 1, 1, 1),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(0, 1, 0, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 1, 0, 0))},
+    [TETROMINO_O] = {SHAPE(ROW(0, 1, 1, 0), ROW(0, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 1, 0), ROW(0, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 1, 0), ROW(0, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 1, 0), ROW(0, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0))},
+    [TETROMINO_T] = {SHAPE(ROW(0, 1, 0, 0), ROW(1, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(0, 1, 1, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 0, 0), ROW(1, 1, 1, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(1, 1, 0, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0))},
+    [TETROMINO_S] = {SHAPE(ROW(0, 1, 1, 0), ROW(1, 1, 0, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(0, 1, 1, 0), ROW(0, 0, 1, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 0, 0), ROW(0, 1, 1, 0), ROW(1, 1, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(1, 0, 0, 0), ROW(1, 1, 0, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0))},
+    [TETROMINO_Z] = {SHAPE(ROW(1, 1, 0, 0), ROW(0, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 1, 0), ROW(0, 1, 1, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 0, 0), ROW(1, 1, 0, 0), ROW(0, 1, 1, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(1, 1, 0, 0), ROW(1, 0, 0, 0),
+                           ROW(0, 0, 0, 0))},
+    [TETROMINO_J] = {SHAPE(ROW(1, 0, 0, 0), ROW(1, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 1, 0), ROW(0, 1, 0, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 0, 0), ROW(1, 1, 1, 0), ROW(0, 0, 1, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(0, 1, 0, 0), ROW(1, 1, 0, 0),
+                           ROW(0, 0, 0, 0))},
+    [TETROMINO_L] = {SHAPE(ROW(0, 0, 1, 0), ROW(1, 1, 1, 0), ROW(0, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 1, 0, 0), ROW(0, 1, 0, 0), ROW(0, 1, 1, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(0, 0, 0, 0), ROW(1, 1, 1, 0), ROW(1, 0, 0, 0),
+                           ROW(0, 0, 0, 0)),
+                     SHAPE(ROW(1, 1, 0, 0), ROW(0, 1, 0, 0), ROW(0, 1, 0, 0),
+                           ROW(0, 0, 0, 0))}};
+
+/**
+ * @brief Смещение или позиция фигуры на поле (ось Y направлена вниз).
+ */
+typedef struct {
+  int8_t dx;
+  int8_t dy;
+} KickOffset_t;
+
+enum { KICKS_JLSTZ, KICKS_I, NUM_KICK_SETS };
+
+/**
+ * @brief Смещения SRS: [набор][исходная ориентация][направление][попытка].
+ */
+static const KickOffset_t kicks[NUM_KICK_SETS][NUM_ORIENTATIONS][2]
+                               [TETROMINO_KICKS] = {
+    [KICKS_JLSTZ] =
+        {[ToTop] = {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}},
+                    {{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+         [ToRight] = {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}},
+                      {{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},
+         [ToBottom] = {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}},
+                       {{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},
+         [ToLeft] = {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}},
+                     {{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}}},
+    [KICKS_I] = {[ToTop] = {{{0, 0}, {-2, 0}, {1, 0}, {-2, 1}, {1, -2}},
+                            {{0, 0}, {-1, 0}, {2, 0}, {-1, -2}, {2, 1}}},
+                 [ToRight] = {{{0, 0}, {-1, 0}, {2, 0}, {-1, -2}, {2, 1}},
+                              {{0, 0}, {2, 0}, {-1, 0}, {2, -1}, {-1, 2}}},
+                 [ToBottom] = {{{0, 0}, {2, 0}, {-1, 0}, {2, -1}, {-1, 2}},
+                               {{0, 0}, {1, 0}, {-2, 0}, {1, 2}, {-2, -1}}},
+                 [ToLeft] = {{{0, 0}, {1, 0}, {-2, 0}, {1, 2}, {-2, -1}},
+                             {{0, 0}, {-2, 0}, {1, 0}, {-2, 1}, {1, -2}}}}};
+
+/**
+ * @brief Позиции появления фигур (левый верхний угол матрицы 4x4).
+ */
+static const KickOffset_t spawnPositions[NUM_TETROMINOES] = {
+    [TETROMINO_I] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, -1},
+    [TETROMINO_O] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, 0},
+    [TETROMINO_T] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, 0},
+    [TETROMINO_S] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, 0},
+    [TETROMINO_Z] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, 0},
+    [TETROMINO_J] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, 0},
+    [TETROMINO_L] = {(FIELD_WIDTH - TETROMINO_SIZE) / 2, 0}};
+
+static bool isValidTetromino(int type, gameBlockOrientation orientation) {
+  return type >= 0 && type < NUM_TETROMINOES && orientation >= ToTop &&
+         orientation <= ToLeft;
+}
+
+TetrominoShape_t getTetrominoShape(int type, gameBlockOrientation orientation) {
+  if (!isValidTetromino(type, orientation)) return 0;
+
+  return shapes[type][orientation];
+}
+
+void getTetrominoRows(int type, gameBlockOrientation orientation,
+                      FieldRow_t* rows) {
+  TetrominoShape_t shape = getTetrominoShape(type, orientation);
+
+  for (int i = 0; i < TETROMINO_SIZE; i++) {
+    rows[i] = (FieldRow_t)((shape >> (TETROMINO_SIZE * i)) & 0xFu);
+  }
+}
+
+bool tetrominoFits(const GameField_t* field, int type,
+                   gameBlockOrientation orientation, int posX, int posY) {
+  FieldRow_t rows[TETROMINO_SIZE];
+
+  if (!isValidTetromino(type, orientation)) return false;
+
+  getTetrominoRows(type, orientation, rows);
+  return !fieldCollides(field, rows, TETROMINO_SIZE, posX, posY);
+}
+
+int spawnTetromino(GameBlock_t* block, int type) {
+  if (!block || type < 0 || type >= NUM_TETROMINOES) return 1;
+
+  block->type = type;
+  block->size = TETROMINO_SIZE;
+  block->posX = spawnPositions[type].dx;
+  block->posY = spawnPositions[type].dy;
+  block->orientation = ToTop;
+
+  return 0;
+}
+
+int rotateTetromino(const GameField_t* field, GameBlock_t* block,
+                    RotationDirection direction) {
+  if (!field || !block ||
+      !isValidTetromino(block->type, block->orientation) ||
+      (direction != ROTATE_CLOCKWISE && direction != ROTATE_COUNTERCLOCKWISE))
+    return 1;
+
+  int step = direction == ROTATE_CLOCKWISE ? 1 : NUM_ORIENTATIONS - 1;
+  gameBlockOrientation target =
+      (gameBlockOrientation)((block->orientation + step) % NUM_ORIENTATIONS);
+  const KickOffset_t* offsets =
+      kicks[block->type == TETROMINO_I ? KICKS_I : KICKS_JLSTZ]
+           [block->orientation][direction];
+
+  for (int i = 0; i < TETROMINO_KICKS; i++) {
+    int posX = block->posX + offsets[i].dx;
+    int posY = block->posY + offsets[i].dy;
+    if (tetrominoFits(field, block->type, target, posX, posY)) {
+      block->posX = posX;
+      block->posY = posY;
+      block->orientation = target;
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int tetrominoToMatrix(int type, gameBlockOrientation orientation,
+                      int** matrix) {
+  if (!matrix || !isValidTetromino(type, orientation)) return 1;
+
+  TetrominoShape_t shape = shapes[type][orientation];
+  for (int i = 0; i < TETROMINO_SIZE; i++) {
+    for (int j = 0; j < TETROMINO_SIZE; j++) {
+      matrix[i][j] = (shape >> (TETROMINO_SIZE * i + j)) & 1u ? type + 1 : 0;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file tetromino.h
+ * @brief Таблицы фигур (тетромино) игры Tetris
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Этот модуль содержит вычисляемые на этапе компиляции таблицы
+ * 7 фигур x 4 ориентации (gameBlockOrientation) в виде упакованных битовых
+ * масок 4x4, таблицы смещений при повороте у стены (wall kicks, система SRS)
+ * и таблицу позиций появления фигур. Поворот фигуры сводится к смене индекса
+ * ориентации и проверке столкновения по таблице смещений, без выделения
+ * памяти.
+ *
+ * Упаковка маски фигуры: строка `r` матрицы 4x4 хранится в битах
+ * `4r .. 4r + 3`, бит `c` строки соответствует столбцу `c` матрицы.
+ */
+
+#ifndef TETROMINO_H
+#define TETROMINO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../common/brick_game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def TETROMINO_SIZE
+ * @brief Размер стороны матрицы фигуры
+ */
+#define TETROMINO_SIZE MAX_GAMEBLOCK_SIZE
+
+/**
+ * @def TETROMINO_KICKS
+ * @brief Количество проверяемых смещений при повороте фигуры
+ */
+#define TETROMINO_KICKS 5
+
+/**
+ * @def NUM_ORIENTATIONS
+ * @brief Количество ориентаций фигуры (gameBlockOrientation)
+ */
+#define NUM_ORIENTATIONS 4
+
+/**
+ * @enum TetrominoType
+ * @brief Перечисление видов фигур.
+ * @details Значение используется в поле GameBlock_t::type. Цвет фигуры на поле
+ * равен `type + 1`.
+ */
+typedef enum {
+  TETROMINO_I,
+  TETROMINO_O,
+  TETROMINO_T,
+  TETROMINO_S,
+  TETROMINO_Z,
+  TETROMINO_J,
+  TETROMINO_L,
+  NUM_TETROMINOES  ///< Количество видов фигур
+} TetrominoType;
+
+/**
+ * @enum RotationDirection
+ * @brief Направление поворота фигуры.
+ */
+typedef enum {
+  ROTATE_CLOCKWISE,        ///< По часовой стрелке
+  ROTATE_COUNTERCLOCKWISE  ///< Против часовой стрелки
+} RotationDirection;
+
+/**
+ * @brief Упакованная маска фигуры 4x4
+ */
+typedef uint16_t TetrominoShape_t;
+
+/**
+ * @defgroup TetrominoRoutines Функции работы с фигурами
+ * @brief Функции появления, поворота и проверки столкновений фигур
+ */
+
+/**
+ * @ingroup TetrominoRoutines
+ * @brief Возвращает упакованную маску фигуры в заданной ориентации.
+ * @return Маска фигуры или 0 при недопустимых параметрах.
+ */
+TetrominoShape_t getTetrominoShape(int type, gameBlockOrientation orientation);
+
+/**
+ * @ingroup TetrominoRoutines
+ * @brief Распаковывает маску фигуры в маски строк поля.
+ * @param rows Массив из TETROMINO_SIZE масок строк (бит `c` — столбец `c`).
+ */
+void getTetrominoRows(int type, gameBlockOrientation orientation,
+                      FieldRow_t* rows);
+
+/**
+ * @ingroup TetrominoRoutines
+ * @brief Проверяет, помещается ли фигура на поле в заданной позиции.
+ * @return true, если фигура не пересекается с занятыми клетками поля.
+ */
+bool tetrominoFits(const GameField_t* field, int type,
+                   gameBlockOrientation orientation, int posX, int posY);
+
+/**
+ * @ingroup TetrominoRoutines
+ * @brief Устанавливает блок в позицию появления фигуры заданного вида.
+ * @return 0 в случае успеха, 1 при недопустимых параметрах.
+ */
+int spawnTetromino(GameBlock_t* block, int type);
+
+/**
+ * @ingroup TetrominoRoutines
+ * @brief Поворачивает фигуру с учетом смещений у стены (SRS).
+ * @param field Указатель на поле.
+ * @param block Указатель на блок фигуры.
+ * @param direction Направление поворота (RotationDirection).
+ * @return 0, если поворот выполнен, 1 — если все смещения заняты.
+ */
+int rotateTetromino(const GameField_t* field, GameBlock_t* block,
+                    RotationDirection direction);
+
+/**
+ * @ingroup TetrominoRoutines
+ * @brief Формирует матричное представление фигуры (например, для
+ * GameInfo_t::next).
+ * @param matrix Матрица размером не менее TETROMINO_SIZE x TETROMINO_SIZE.
+ * @return 0 в случае успеха, 1 при ошибке параметров.
+ */
+int tetrominoToMatrix(int type, gameBlockOrientation orientation,
+                      int** matrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
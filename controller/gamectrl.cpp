@@ -1,40 +1,486 @@
 #include "gamectrl.hpp"
 
-s21::GameController::GameController() {}
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+// Размер буфера чтения терминала за одно пробуждение.
+constexpr int kInputBufferSize = 64;
+
+// Пауза потока чтения при заполненной очереди ввода.
+constexpr std::chrono::milliseconds kQueueFullBackoff{1};
+
+// Канал без блокировки записи и чтения.
+bool openPipe(int fds[2]) {
+    if (pipe(fds)) return false;
+    for (int i = 0; i < 2; i++) {
+        fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+    }
+    return true;
+}
+
+// Пробуждение игрового цикла. Переполненный канал уже разбудит цикл,
+// поэтому ошибка записи не учитывается.
+void notify(int fd) {
+    char wake = 0;
+    ssize_t written = write(fd, &wake, 1);
+    (void)written;
+}
+
+void closePipe(int fds[2]) {
+    for (int i = 0; i < 2; i++) {
+        if (fds[i] >= 0) close(fds[i]);
+        fds[i] = -1;
+    }
+}
+
+// Раскладка элементов представления в порядке layoutElements.
+struct ElementLayout {
+    int type;
+    int top;
+    int left;
+    int width;
+    int height;
+    const char* label;
+};
+
+constexpr int kPanelLeft = 25;
+constexpr std::size_t kHintTextSize = 32;
+constexpr int kPanelWidth = 8;
+
+const ElementLayout kLayout[s21::kNumViewElements] = {
+    {DATA_TYPE_INT2D, 0, 0, FIELD_WIDTH, FIELD_HEIGHT, GET_MNAME(1)},
+    {DATA_TYPE_INT2D, 0, kPanelLeft, MAX_GAMEBLOCK_SIZE, MAX_GAMEBLOCK_SIZE,
+     GET_MNAME(2)},
+    {DATA_TYPE_INT, 6, kPanelLeft, kPanelWidth, 1, GET_MNAME(3)},
+    {DATA_TYPE_INT, 9, kPanelLeft, kPanelWidth, 1, GET_MNAME(4)},
+    {DATA_TYPE_INT, 12, kPanelLeft, kPanelWidth, 1, GET_MNAME(5)},
+    {DATA_TYPE_INT, 15, kPanelLeft, kPanelWidth, 1, GET_MNAME(6)},
+    {DATA_TYPE_STR, 18, kPanelLeft, kPanelWidth, 1, GET_MNAME(7)},
+};
+
+#ifdef BRICKGAME_PROFILE
+// Длительность в микросекундах для вывода в HINTS.
+long long microseconds(std::int64_t nanoseconds) {
+    return static_cast<long long>(nanoseconds / NSEC_PER_USEC);
+}
+#endif
+
+}  // namespace
+
+s21::GameController::GameController(ViewInterface* view,
+                                    const SessionOptions& options)
+    : options(options), view(view), inputFd(STDIN_FILENO) {}
 
 int s21::GameController::run() {
   this->initialize();
-  return this->mainLoop();
+  return replay ? this->replayLoop() : this->mainLoop();
 }
 
 void s21::GameController::initialize() {
+    // Вся память модели на время сессии выделяется одним блоком.
+    arena = createSessionArena(SESSION_ARENA_SIZE);
     gameInfo = createGameInfo();
-    fsm = fsm_create(&gameStates, NUM_STATES, gameInfo);
+    loadHighScore();
+    gameField = createGameField();
+    gameBlocks = createGameBlockQueue();
+    std::uint64_t seed = options.hasSeed
+                             ? options.seed
+                             : static_cast<std::uint64_t>(time(nullptr));
+    bool logOpened = openSessionLog(&seed);
+    rng = createGameRng(seed);
+    createGameModel();
+    if (options.autoplay && !replay)
+        autoplayer = createAutoplayer(options.autoplayThreads);
+    fsm = fsm_create(gameStates, NUM_STATES, NUM_TRIGGERS, gameInfo);
     fsm_processTrigger(fsm, TRIGGER_INIT);
+    initTimerService(&timers);
+    startTimer(&timers, kModelTimer, tickInterval(), tickInterval(),
+               clockNow());
+    resumeSnapshot();
+    initKeyRepeat(&keyRepeat, KEY_DAS_DEFAULT, KEY_ARR_DEFAULT);
+    setupView();
+    enableRawInput();
+    if (!startInputReader() || !logOpened)
+        fsm_processTrigger(fsm, TRIGGER_TERMINATE);
 }
 
-int s21::GameController::mainLoop() { 
+// Воспроизводимая запись задает начальное значение генератора, иначе
+// создается запись сессии (если задан файл).
+bool s21::GameController::openSessionLog(std::uint64_t* seed) {
+    if (options.replayPath) {
+        if (!(replay = openInputLog(options.replayPath, seed)))
+            failedPath = options.replayPath;
+    } else if (options.recordPath) {
+        if (!(inputLog = createInputLog(options.recordPath, *seed,
+                                        &options.clock)))
+            failedPath = options.recordPath;
+    }
+
+    return failedPath == nullptr;
+}
+
+int s21::GameController::mainLoop() {
     while (fsm->currentState != STATE_TERMINATE) {
+        PROFILE_BEGIN(PROFILE_FRAME);
+        processInput();
+        if (autoplayer) autoplayMove(autoplayer);
+        std::int64_t now = clockNow();
+        for (int id = pollExpiredTimer(&timers, now);
+             id != TIMER_NONE && fsm->currentState != STATE_TERMINATE;
+             id = pollExpiredTimer(&timers, now)) {
+            if (id == kModelTimer) {
+                if (inputLog) logModelTick(inputLog);
+                fsm_update(fsm);
+            } else {
+                processKeyTimer(&keyRepeat, &timers, id, now);
+            }
+        }
+        // Скорость могла измениться (новый уровень).
+        setTimerInterval(&timers, kModelTimer, tickInterval());
+        submitFinishedGame();
+        presentFrame();
+        PROFILE_END(PROFILE_FRAME);
+
+        if (fsm->currentState != STATE_TERMINATE)
+            waitForInput(timeUntilNextTimer(&timers, clockNow()));
+    }
+
+    return cleanup();
+}
+
+// Воспроизведение записи в записанном темпе. После окончания записи
+// последний кадр остается на экране до выхода.
+int s21::GameController::replayLoop() {
+    InputLogEvent_t event{};
+    InputLogStatus status = readInputLogEvent(replay, &event);
+    std::int64_t start = clockNow();
+
+    while (fsm->currentState != STATE_TERMINATE) {
+        PROFILE_BEGIN(PROFILE_FRAME);
+        processInput();
+        if (autoplayer) autoplayMove(autoplayer);
+        std::int64_t now = clockNow();
+        while (status == INPUT_LOG_OK && start + event.time <= now &&
+               fsm->currentState != STATE_TERMINATE) {
+            applyLogEvent(event);
+            status = readInputLogEvent(replay, &event);
+        }
+        if (status == INPUT_LOG_CORRUPT) failedPath = options.replayPath;
+        presentFrame();
+        PROFILE_END(PROFILE_FRAME);
+
+        if (fsm->currentState != STATE_TERMINATE) {
+            std::int64_t wait = start + event.time - clockNow();
+            waitForInput(status != INPUT_LOG_OK ? -1 : wait > 0 ? wait : 0);
+        }
+    }
+
+    return cleanup();
+}
+
+void s21::GameController::applyLogEvent(const InputLogEvent_t& event) {
+    if (event.type == INPUT_LOG_TICK) {
         fsm_update(fsm);
-        usleep(1000000 / gameInfo->speed);  // Добавлена задержка
+    } else {
+        userInput(event.action, event.hold);
     }
+}
 
-    cleanup();
+std::int64_t s21::GameController::clockNow() const {
+    return readGameClock(&options.clock);
+}
+
+// Ожидание сигнала потока чтения не дольше timeout наносекунд (-1 — без
+// ограничения).
+bool s21::GameController::waitForInput(std::int64_t timeout) {
+    pollfd wake{wakePipe[0], POLLIN, 0};
+    timespec wait{static_cast<time_t>(timeout / NSEC_PER_SEC),
+                  static_cast<long>(timeout % NSEC_PER_SEC)};
 
-    return EXIT_SUCCESS;
+    bool ready = ppoll(&wake, 1, timeout < 0 ? nullptr : &wait, nullptr) > 0 &&
+                 (wake.revents & POLLIN);
+    if (ready) {
+        char buffer[kInputBufferSize];
+        while (read(wakePipe[0], buffer, sizeof(buffer)) > 0) {
+        }
+    }
+
+    return ready;
+}
+
+// Обработка событий ввода из очереди в порядке поступления.
+void s21::GameController::processInput() {
+    InputEvent_t event;
+
+    while (fsm->currentState != STATE_TERMINATE &&
+           popInputEvent(inputQueue, &event)) {
+        if (static_cast<ControlKey>(event.control) ==
+            ControlKey::HudToggle) {
+            hudVisible = !hudVisible;
+            continue;
+        }
+        // Воспроизведение не смешивается с вводом пользователя.
+        if (replay && event.action != Terminate) continue;
+        if (event.action == Terminate) saveSnapshot();
+        processKeyEvent(&keyRepeat, &timers, &event, clockNow());
+        syncPause();
+    }
+}
+
+bool s21::GameController::startInputReader() {
+    if (!(inputQueue = createInputQueue())) return false;
+    if (!openPipe(wakePipe) || !openPipe(stopPipe)) return false;
+
+    inputReader = std::thread(&GameController::readInput, this);
+    return true;
 }
-// Обработка сигналов нажатых клавиш. Должно орабатываться также "зажатие клавиши".
-void s21::GameController::handleInput() {
-    userInput(action, hold); //Вызываем обработчик действий пользователя в модели.
+
+void s21::GameController::stopInputReader() {
+    if (inputReader.joinable()) {
+        notify(stopPipe[1]);
+        inputReader.join();
+    }
+    closePipe(wakePipe);
+    closePipe(stopPipe);
+    destroyInputQueue(inputQueue);
+    inputQueue = nullptr;
 }
 
-void s21::GameController::cleanup() {
+// Поток чтения терминала: события с метками времени помещаются в очередь.
+void s21::GameController::readInput() {
+    char buffer[kInputBufferSize];
+    bool reading = true;
+
+    while (reading) {
+        pollfd fds[2] = {{inputFd, POLLIN, 0}, {stopPipe[0], POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (fds[1].revents) break;
+        if (!fds[0].revents) continue;
+
+        ssize_t size = read(inputFd, buffer, sizeof(buffer));
+        if (size < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+
+        InputEvent_t event{clockNow(), Terminate, 0};
+        if (size <= 0) {
+            // Конец ввода (терминал закрыт) завершает игру.
+            pushInput(event);
+            reading = false;
+            continue;
+        }
+        KeyEvent keys[kInputBufferSize];
+        std::size_t count = keyDecoder.decode(
+            buffer, static_cast<std::size_t>(size), keys);
+        for (std::size_t i = 0; i < count; i++) {
+            event.action = keys[i].action;
+            event.control = static_cast<std::uint8_t>(keys[i].control);
+            pushInput(event);
+        }
+    }
+}
+
+// Добавление события без потерь: при заполненной очереди поток чтения
+// ожидает ее обработки игровым циклом.
+void s21::GameController::pushInput(const InputEvent_t& event) {
+    while (pushInputEvent(inputQueue, &event)) {
+        notify(wakePipe[1]);
+        std::this_thread::sleep_for(kQueueFullBackoff);
+    }
+    notify(wakePipe[1]);
+}
+
+int s21::GameController::cleanup() {
+    stopInputReader();
+    restoreInput();
+#ifdef BRICKGAME_PROFILE
+    if (saveProfileReport(kProfileReportPath))
+        std::perror(kProfileReportPath);
+#endif
+    if (inputLog && destroyInputLog(inputLog) && !failedPath)
+        failedPath = options.recordPath;
+    inputLog = nullptr;
+    closeInputLog(replay);
+    replay = nullptr;
+    if (failedPath)
+        std::fprintf(stderr, "Session log error: %s\n", failedPath);
+    destroyAutoplayer(autoplayer);
+    autoplayer = nullptr;
     if (fsm) {
         fsm_destroy(fsm);
         fsm = nullptr;
     }
+    destroyGameModel();
+    if (rng) {
+        destroyGameRng(rng);
+        rng = nullptr;
+    }
+    if (gameBlocks) {
+        destroyGameBlockQueue(gameBlocks);
+        gameBlocks = nullptr;
+    }
+    if (gameField) {
+        destroyGameField(gameField);
+        gameField = nullptr;
+    }
     if (gameInfo) {
         destroyGameInfo(gameInfo);
         gameInfo = nullptr;
     }
+    if (arena) {
+        destroySessionArena(arena);
+        arena = nullptr;
+    }
+
+    return failedPath ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Неканонический режим терминала: клавиши доступны без ожидания Enter.
+void s21::GameController::enableRawInput() {
+    if (!isatty(inputFd) || tcgetattr(inputFd, &savedTermios)) return;
+
+    termios raw = savedTermios;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 0;
+    raw.c_cc[VTIME] = 0;
+    rawInput = tcsetattr(inputFd, TCSANOW, &raw) == 0;
+}
+
+void s21::GameController::restoreInput() {
+    if (rawInput) {
+        tcsetattr(inputFd, TCSANOW, &savedTermios);
+        rawInput = false;
+    }
+}
+
+// Пауза модели приостанавливает таймеры, снятие паузы — возобновляет.
+void s21::GameController::syncPause() {
+    if (gameInfo->pause && !timers.paused) {
+        pauseTimerService(&timers, clockNow());
+        saveSnapshot();
+    } else if (!gameInfo->pause && timers.paused) {
+        resumeTimerService(&timers, clockNow());
+    }
+}
+
+void s21::GameController::loadHighScore() {
+    Leaderboard_t* leaderboard = openLeaderboard(kLeaderboardPath);
+    if (gameInfo)
+        gameInfo->high_score =
+            getLeaderboardHighScore(leaderboard, kLeaderboardGame);
+    closeLeaderboard(leaderboard);
+}
+
+// Результат завершенной игры добавляется в таблицу рекордов. Ошибка записи
+// таблицы не прерывает игру.
+void s21::GameController::submitFinishedGame() {
+    unsigned long games = getGameCounters()->games;
+    if (games == finishedGames) return;
+
+    finishedGames = games;
+    LeaderboardEntry_t entry{gameInfo->score, gameInfo->level,
+                             static_cast<std::int64_t>(time(nullptr))};
+    submitLeaderboardScore(kLeaderboardPath, kLeaderboardGame, &entry);
+    // Снимок, сохраненный на паузе, относится к завершенной игре.
+    if (usesSnapshot()) std::remove(kSnapshotPath);
+}
+
+// Запись и воспроизведение сессии начинаются с новой игры, поэтому снимок
+// в них не используется.
+bool s21::GameController::usesSnapshot() const {
+    return !options.recordPath && !options.replayPath;
+}
+
+bool s21::GameController::isGameInProgress() const {
+    int state = fsm->currentState;
+    return state != STATE_IDLE && state != STATE_START &&
+           state != STATE_GAME_OVER && state != STATE_TERMINATE;
+}
+
+// Продолжение игры из снимка без инициализации новой игры. Снимок удаляется,
+// чтобы следующий запуск не вернул уже продолженную игру.
+void s21::GameController::resumeSnapshot() {
+    if (!usesSnapshot()) return;
+
+    loadGameSnapshot(kSnapshotPath, &timers, clockNow());
+    std::remove(kSnapshotPath);
+}
+
+void s21::GameController::saveSnapshot() {
+    if (usesSnapshot() && isGameInProgress())
+        saveGameSnapshot(kSnapshotPath, &timers, clockNow());
+}
+
+// Интервал такта модели: 1 с на первой скорости, speed тактов в секунду.
+std::int64_t s21::GameController::tickInterval() const {
+    int speed = gameInfo->speed > 0 ? gameInfo->speed : 1;
+    return NSEC_PER_SEC / speed;
+}
+
+void s21::GameController::setupView() {
+    if (!view) return;
+
+    for (int i = 0; i < kNumViewElements; i++) {
+        const ElementLayout& element = kLayout[i];
+        viewElements[i] =
+            view->addElement(element.type, element.top, element.left,
+                             element.width, element.height, element.label);
+    }
+}
+
+// Копирование состояния модели в элементы представления и вывод кадра.
+void s21::GameController::presentFrame() {
+    if (!view) return;
+
+    GameInfo_t info;
+    {
+        PROFILE_SCOPE(PROFILE_MODEL_COPY);
+        info = updateCurrentState();
+    }
+    char hint[kHintTextSize];
+    hintText(info, hint, sizeof(hint));
+    {
+        PROFILE_SCOPE(PROFILE_VIEW_REFRESH);
+        view->refreshElemenet(viewElements[GameFrame], DATA_TYPE_INT2D,
+                              info.field);
+        view->refreshElemenet(viewElements[NextFigureFrame], DATA_TYPE_INT2D,
+                              info.next);
+        view->refreshElemenet(viewElements[ScoreFrame], DATA_TYPE_INT,
+                              &info.score);
+        view->refreshElemenet(viewElements[TopScoreFrame], DATA_TYPE_INT,
+                              &info.high_score);
+        view->refreshElemenet(viewElements[LevelFrame], DATA_TYPE_INT,
+                              &info.level);
+        view->refreshElemenet(viewElements[SpeedFrame], DATA_TYPE_INT,
+                              &info.speed);
+        view->refreshElemenet(viewElements[PauseStatusFrame], DATA_TYPE_STR,
+                              hint);
+    }
+    {
+        PROFILE_SCOPE(PROFILE_VIEW_RENDER);
+        view->render();
+    }
+}
+
+// Текст HINTS: признак паузы или p50/p99/max длительности кадра (мкс).
+void s21::GameController::hintText(const GameInfo_t& info, char* text,
+                                   std::size_t size) const {
+    std::snprintf(text, size, "%s", info.pause ? "PAUSE" : "");
+#ifdef BRICKGAME_PROFILE
+    ProfileStats_t stats;
+    if (hudVisible && !getProfileStats(PROFILE_FRAME, &stats)) {
+        std::snprintf(text, size, "%lld/%lld/%lld", microseconds(stats.p50),
+                      microseconds(stats.p99), microseconds(stats.max));
+    }
+#endif
 }
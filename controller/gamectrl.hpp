@@ -5,13 +5,72 @@
  * @version 1.0
  * @date Март 2025
  *
- * @details Этот модуль реализует контроллер Brick Game
- * 
- * @todo Интегрировать представление (View);
+ * @details Этот модуль реализует контроллер Brick Game.
+ *
+ * Игровой цикл управляется службой таймеров (game_timer.h) на монотонных
+ * часах: такт модели выполняется по таймеру (TIMER_GRAVITY, для Snake —
+ * TIMER_SNAKE_STEP), период которого перезапускается от предыдущего срока,
+ * поэтому время работы модели не сдвигает расписание тактов. Между тактами
+ * контроллер ожидает ввода (ppoll) ровно до ближайшего срока таймера,
+ * поэтому ввод обрабатывается сразу после поступления. Пауза игры
+ * приостанавливает службу таймеров без смещения расписания.
+ *
+ * Терминал читает отдельный поток: он декодирует клавиши без ожидания
+ * тайм-аута Esc (key_decoder.hpp), присваивает нажатиям метки времени,
+ * помещает их в очередь без блокировок (input_queue.h) и будит игровой цикл
+ * записью в канал (pipe). Игровой цикл распознает по меткам времени
+ * нажатие, удержание и отпускание клавиш и повторяет удерживаемые
+ * перемещения по таймерам TIMER_DAS/TIMER_ARR (key_repeat.h).
+ *
+ * После обработки событий контроллер копирует состояние модели
+ * (updateCurrentState()) в элементы представления (ViewInterface) и выводит
+ * кадр. При сборке с BRICKGAME_PROFILE участки кадра измеряются
+ * (profiler.h): клавиша h переключает вывод p50/p99/max длительности кадра
+ * в элементе HINTS, при завершении игры отчет записывается в файл
+ * kProfileReportPath.
+ *
+ * Время игрового цикла читается из источника SessionOptions::clock, а
+ * начальное значение генератора модели задается параметрами сессии (по
+ * умолчанию — текущее время). Сессию можно записать (input_log.h): действия,
+ * переданные модели, и такты модели записываются с метками времени. При
+ * воспроизведении записи такты и действия передаются модели в записанном
+ * порядке и темпе, а ввод пользователя принимается только для выхода и
+ * переключения HUD.
+ *
+ * Лучший результат при запуске читается из таблицы рекордов
+ * (leaderboard.h, файл kLeaderboardPath), результат каждой завершенной игры
+ * добавляется в таблицу.
+ *
+ * При паузе и выходе из незавершенной игры состояние игры сохраняется в
+ * снимок (game_snapshot.h, файл kSnapshotPath), при запуске игра
+ * продолжается из снимка. Снимок удаляется при загрузке и по окончании
+ * игры. При записи и воспроизведении сессии снимки не используются.
+ *
+ * С параметром SessionOptions::autoplay ходы выбирает автоматический игрок
+ * (autoplayer.h): в каждом кадре после обработки ввода он передает модели
+ * действия очередного хода, поэтому ход игрока попадает в запись сессии.
+ * При воспроизведении записи игрок не создается.
  */
 
 #pragma once
 
+#include <termios.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <thread>
+
+#include "../brick_game/common/autoplayer.h"
+#include "../brick_game/common/game_snapshot.h"
+#include "../brick_game/common/game_timer.h"
+#include "../brick_game/common/input_log.h"
+#include "../brick_game/common/input_queue.h"
+#include "../brick_game/common/leaderboard.h"
+#include "../brick_game/common/key_repeat.h"
+#include "../brick_game/common/profiler.h"
+#include "../gui/view/view.hpp"
+#include "key_decoder.hpp"
 #ifdef SNAKE
 #include "../brick_game/snake/snake.h"
 #else
@@ -20,19 +79,103 @@
 
 namespace s21 {
 
+    /// Таймер такта модели.
+#ifdef SNAKE
+    constexpr GameTimerID kModelTimer = TIMER_SNAKE_STEP;
+#else
+    constexpr GameTimerID kModelTimer = TIMER_GRAVITY;
+#endif
+
+    /// Таблица рекордов игры.
+#ifdef SNAKE
+    constexpr LeaderboardGame kLeaderboardGame = LEADERBOARD_SNAKE;
+#else
+    constexpr LeaderboardGame kLeaderboardGame = LEADERBOARD_TETRIS;
+#endif
+
+    /// Количество элементов представления (см. layoutElements).
+    constexpr int kNumViewElements = PauseStatusFrame + 1;
+
+    /// Файл отчета о длительностях участков кадра.
+    constexpr const char* kProfileReportPath = "brickgame_profile.txt";
+
+    /// Файл таблицы рекордов.
+    constexpr const char* kLeaderboardPath = "brickgame_scores.dat";
+
+    /// Файл снимка состояния незавершенной игры.
+    constexpr const char* kSnapshotPath = "brickgame_snapshot.bin";
+
+    /// Параметры сессии: источники времени и случайности, запись сессии.
+    /// Источник времени читается также потоком чтения терминала.
+    struct SessionOptions {
+        GameClock_t clock{nullptr, nullptr};  ///< Источник времени цикла
+        bool hasSeed = false;                 ///< Задано начальное значение
+        std::uint64_t seed = 0;               ///< Начальное значение модели
+        const char* recordPath = nullptr;     ///< Файл записи сессии
+        const char* replayPath = nullptr;     ///< Воспроизводимая запись
+        bool autoplay = false;                ///< Автоматический игрок
+        int autoplayThreads = 0;              ///< Потоки поиска хода игрока
+    };
+
     class GameController {
         public:
-            int run();            
+            explicit GameController(ViewInterface* view = nullptr,
+                                    const SessionOptions& options = {});
+            int run();
         private:
             void initialize();
+            bool openSessionLog(std::uint64_t* seed);
             int mainLoop();
-            void handleInput();
-            void cleanup();
+            int replayLoop();
+            void applyLogEvent(const InputLogEvent_t& event);
+            std::int64_t clockNow() const;
+            bool waitForInput(std::int64_t timeout);
+            void processInput();
+            int cleanup();
+            void enableRawInput();
+            void restoreInput();
+            bool startInputReader();
+            void stopInputReader();
+            void readInput();
+            void pushInput(const InputEvent_t& event);
+            void syncPause();
+            void loadHighScore();
+            void submitFinishedGame();
+            bool usesSnapshot() const;
+            bool isGameInProgress() const;
+            void resumeSnapshot();
+            void saveSnapshot();
+            std::int64_t tickInterval() const;
+            void setupView();
+            void presentFrame();
+            void hintText(const GameInfo_t& info, char* text,
+                          std::size_t size) const;
 
+            SessionArena_t* arena = nullptr;
             FiniteStateMachine* fsm = nullptr;
             GameInfo_t* gameInfo = nullptr;
-    }
+            GameField_t* gameField = nullptr;
+            GameBlockQueue_t* gameBlocks = nullptr;
+            GameRng_t* rng = nullptr;
+            SessionOptions options;
+            InputLog_t* inputLog = nullptr;
+            InputLogReader_t* replay = nullptr;
+            Autoplayer_t* autoplayer = nullptr;
+            const char* failedPath = nullptr;
+            GameTimerService_t timers{};
+            InputQueue_t* inputQueue = nullptr;
+            KeyRepeat_t keyRepeat{};
+            KeyDecoder keyDecoder;
+            std::thread inputReader;
+            int wakePipe[2] = {-1, -1};
+            int stopPipe[2] = {-1, -1};
+            ViewInterface* view;
+            int viewElements[kNumViewElements] = {};
+            bool hudVisible = false;
+            unsigned long finishedGames = 0;
+            int inputFd;
+            bool rawInput = false;
+            termios savedTermios{};
+    };
 
 };
-
-#endif
\ No newline at end of file
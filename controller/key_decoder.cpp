@@ -0,0 +1,113 @@
+#include "key_decoder.hpp"
+
+namespace {
+
+// Код клавиши Escape.
+constexpr unsigned char kEscape = 0x1b;
+
+// Максимальная длина последовательности CSI; более длинная пропускается.
+constexpr std::size_t kMaxSequenceLength = 16;
+
+// Сопоставление стрелок (последний байт CSI/SS3) действиям пользователя.
+bool arrowAction(unsigned char code, UserAction_t& action) {
+    switch (code) {
+        case 'A': action = Up; return true;
+        case 'B': action = Down; return true;
+        case 'C': action = Right; return true;
+        case 'D': action = Left; return true;
+        default: return false;
+    }
+}
+
+// Сопоставление одиночных клавиш действиям пользователя и служебным
+// клавишам контроллера.
+bool keyEvent(unsigned char key, s21::KeyEvent& event) {
+    switch (key) {
+        case '\n': case '\r': event.action = Start; return true;
+        case 'p': case 'P': event.action = Pause; return true;
+        case 'q': case 'Q': event.action = Terminate; return true;
+        case ' ': event.action = Action; return true;
+        case 'h': case 'H':
+            event.control = s21::ControlKey::HudToggle;
+            return true;
+        default: return false;
+    }
+}
+
+}  // namespace
+
+void s21::KeyDecoder::reset() {
+    state = State::Ground;
+    sequenceLength = 0;
+}
+
+std::size_t s21::KeyDecoder::decode(const char* data, std::size_t size,
+                                    KeyEvent* events) {
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < size;) {
+        bool consumed = true;
+        KeyEvent event;
+        if (decodeByte(static_cast<unsigned char>(data[i]), event, consumed))
+            events[count++] = event;
+        if (consumed) i++;
+    }
+    // Esc в конце буфера не может быть началом последовательности.
+    if (state == State::Escape) {
+        events[count++] = KeyEvent{kEscapeAction};
+        state = State::Ground;
+    }
+
+    return count;
+}
+
+// Обработка одного байта. consumed = false — байт завершил предыдущую
+// последовательность и обрабатывается повторно в начальном состоянии.
+bool s21::KeyDecoder::decodeByte(unsigned char byte, KeyEvent& event,
+                                 bool& consumed) {
+    switch (state) {
+        case State::Ground:
+            if (byte == kEscape) {
+                state = State::Escape;
+                return false;
+            }
+            return keyEvent(byte, event);
+        case State::Escape:
+            if (byte == '[' || byte == 'O') {
+                state = byte == '[' ? State::Csi : State::Ss3;
+                sequenceLength = 0;
+                return false;
+            }
+            // Esc, за которым следует не последовательность, — одиночный.
+            state = State::Ground;
+            consumed = false;
+            event.action = kEscapeAction;
+            return true;
+        case State::Csi:
+            if (byte >= 0x40 && byte <= 0x7e) {
+                state = State::Ground;
+                return arrowAction(byte, event.action);
+            }
+            if (byte < 0x20 || byte > 0x3f) {
+                // Управляющий байт прерывает последовательность.
+                state = State::Ground;
+                consumed = false;
+            } else if (++sequenceLength > kMaxSequenceLength) {
+                state = State::Ground;
+            }
+            return false;
+        case State::Ss3:
+            state = State::Ground;
+            if (byte < 0x20) {
+                consumed = false;
+                return false;
+            }
+            if (byte == 'M') {
+                event.action = Start;  // Enter цифрового блока клавиатуры.
+                return true;
+            }
+            return arrowAction(byte, event.action);
+    }
+
+    return false;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file key_decoder.hpp
+ * @brief Декодер клавиш терминала Brick Game
+ * @author provemet
+ * @version 2.0
+ * @date Октябрь 2026
+ *
+ * @details Декодер преобразует байты, прочитанные из терминала, в события
+ * клавиш (KeyEvent): действия пользователя (UserAction_t) или служебные
+ * клавиши контроллера, — без ожидания тайм-аута. Поддерживаются
+ * последовательности стрелок CSI (ESC [ A..D, в том числе с параметрами,
+ * например ESC [ 1 ; 5 A) и SS3 (ESC O A..D — режим клавиш приложения,
+ * который включает keypad() в ncurses).
+ *
+ * Неоднозначность одиночного Esc и начала последовательности разрешается
+ * по содержимому буфера чтения: терминал передает последовательность
+ * клавиши одной записью, поэтому Esc в конце буфера — одиночное нажатие.
+ * Незавершенная последовательность CSI/SS3 (ESC [ или ESC O в конце
+ * буфера) продолжается в следующем буфере. Нераспознанные
+ * последовательности пропускаются целиком.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../brick_game/common/brick_game.h"
+
+namespace s21 {
+
+    /// Действие одиночной клавиши Esc.
+    constexpr UserAction_t kEscapeAction = Pause;
+
+    /// Служебные клавиши контроллера. В модель не передаются.
+    enum class ControlKey : std::uint8_t {
+        None,      ///< Действие пользователя
+        HudToggle  ///< Клавиша h: вывод показателей времени кадра
+    };
+
+    /// Событие клавиши: действие пользователя или служебная клавиша.
+    struct KeyEvent {
+        UserAction_t action;  ///< Действие (для ControlKey::None)
+        ControlKey control;   ///< Служебная клавиша
+
+        constexpr KeyEvent(UserAction_t action = Start,
+                           ControlKey control = ControlKey::None)
+            : action(action), control(control) {}
+
+        bool operator==(const KeyEvent& other) const {
+            return control == other.control &&
+                   (control != ControlKey::None || action == other.action);
+        }
+    };
+
+    class KeyDecoder {
+        public:
+            /**
+             * @brief Декодирует буфер чтения.
+             * @param events Массив событий не короче size элементов.
+             * @return Количество событий, записанных в events.
+             */
+            std::size_t decode(const char* data, std::size_t size,
+                               KeyEvent* events);
+            void reset();
+
+        private:
+            enum class State { Ground, Escape, Csi, Ss3 };
+
+            bool decodeByte(unsigned char byte, KeyEvent& event,
+                            bool& consumed);
+
+            State state = State::Ground;
+            std::size_t sequenceLength = 0;
+    };
+
+}  // namespace s21
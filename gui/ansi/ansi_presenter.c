@@ -0,0 +1,375 @@
+#include "ansi_presenter.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*!
+  \brief Резерв буфера кадра под одну клетку (перемещение курсора, SGR и
+  символ UTF-8).
+*/
+#define ANSI_CELL_RESERVE 32
+
+/*!
+  \brief Максимальный промежуток, который выгоднее перезаписать символами,
+  чем переместить курсор последовательностью CSI n C.
+*/
+#define ANSI_MAX_SKIP 3
+
+static const char* const glyphs[] = {"", "─", "│", "┌", "┐", "└", "┘"};
+
+static const char* const attributes[] = {"\x1b[0m", "\x1b[0;1m",
+                                         "\x1b[0;7m"};
+
+static void flushFrame(AnsiView_t* view) {
+  size_t written = 0;
+
+  while (view->fd >= 0 && written < view->length) {
+    ssize_t size =
+        write(view->fd, view->buffer + written, view->length - written);
+    if (size < 0 && errno == EINTR) continue;
+    if (size < 0) break;
+    written += (size_t)size;
+    view->stats.writes++;
+  }
+  view->stats.bytes += view->length;
+  view->length = 0;
+}
+
+static void appendString(AnsiView_t* view, const char* string) {
+  size_t length = strlen(string);
+
+  if (view->length + length > ANSI_FRAME_BUFFER_SIZE) flushFrame(view);
+  memcpy(view->buffer + view->length, string, length);
+  view->length += length;
+}
+
+static void appendNumber(AnsiView_t* view, int number) {
+  char digits[12];
+  int count = 0;
+
+  do {
+    digits[count++] = (char)('0' + number % 10);
+    number /= 10;
+  } while (number > 0);
+  while (count > 0) view->buffer[view->length++] = digits[--count];
+}
+
+static bool isSameCell(AnsiCell_t a, AnsiCell_t b) {
+  return a.ch == b.ch && a.attr == b.attr;
+}
+
+static void clearCells(AnsiCell_t (*screen)[ANSI_SCREEN_WIDTH],
+                       uint8_t attr) {
+  for (int i = 0; i < ANSI_SCREEN_HEIGHT; i++) {
+    for (int j = 0; j < ANSI_SCREEN_WIDTH; j++) {
+      screen[i][j] = (AnsiCell_t){' ', attr};
+    }
+  }
+}
+
+static void putCell(AnsiView_t* view, int row, int col, char ch,
+                    uint8_t attr) {
+  if (row >= 0 && row < ANSI_SCREEN_HEIGHT && col >= 0 &&
+      col < ANSI_SCREEN_WIDTH)
+    view->back[row][col] = (AnsiCell_t){ch, attr};
+}
+
+AnsiView_t* initAnsiView(int fd) {
+  AnsiView_t* view = (AnsiView_t*)malloc(sizeof(AnsiView_t));
+
+  if (view) {
+    view->fd = fd;
+    view->size = 0;
+    view->free_head = 0;
+    for (int i = 0; i < ANSI_MAX_ELEMENTS; i++) {
+      view->element[i].used = false;
+      view->element[i].generation = 0;
+      view->element[i].next_free = i + 1 < ANSI_MAX_ELEMENTS ? i + 1 : -1;
+    }
+    view->length = 0;
+    view->stats = (AnsiViewStats_t){0, 0, 0, 0};
+    clearCells(view->back, ANSI_ATTR_NORMAL);
+    clearCells(view->front, ANSI_ATTR_NORMAL);
+    // Альтернативный экран, скрытый курсор, очищенный экран.
+    appendString(view, "\x1b[?1049h\x1b[?25l\x1b[0m\x1b[H\x1b[2J");
+    flushFrame(view);
+    view->cursorRow = 0;
+    view->cursorCol = 0;
+    view->attr = ANSI_ATTR_NORMAL;
+  }
+
+  return view;
+}
+
+void freeAnsiView(AnsiView_t* view) {
+  if (view) {
+    appendString(view, "\x1b[0m\x1b[?25h\x1b[?1049l");
+    flushFrame(view);
+    free(view);
+  }
+}
+
+static void renderElementFrame(AnsiView_t* view, const AnsiElement_t* element,
+                               bool erase) {
+  if (element->height < ANSI_MIN_ELEMENT_DIM ||
+      element->width < ANSI_MIN_ELEMENT_DIM)
+    return;
+
+  int top = element->top;
+  int left = element->left;
+  int height = element->height + 2;
+  int width = element->width + 2;
+
+  if (top < 0)
+    top = 0;
+  else if (top > ANSI_MAX_COORDINATE_VALUE - height)
+    top = ANSI_MAX_COORDINATE_VALUE - height;
+  if (left < 0)
+    left = 0;
+  else if (left > ANSI_MAX_COORDINATE_VALUE - width)
+    left = ANSI_MAX_COORDINATE_VALUE - width;
+
+  int right = left + width * ANSI_PIXEL_WIDTH - 1;
+  int bottom = top + height - 1;
+
+  if (erase) {
+    for (int i = top; i <= bottom; i++) {
+      for (int j = left; j <= right; j++) {
+        putCell(view, i, j, ' ', ANSI_ATTR_NORMAL);
+      }
+    }
+    return;
+  }
+
+  int labelLength = (int)strlen(element->label);
+  if (labelLength > width * ANSI_PIXEL_WIDTH - 2)
+    labelLength = width * ANSI_PIXEL_WIDTH - 2;
+  int labelpos = left + 1 + (width * ANSI_PIXEL_WIDTH - 2 - labelLength) / 2;
+
+  for (int i = left; i <= right; i++) {
+    if (i >= labelpos && i < labelpos + labelLength) {
+      putCell(view, top, i, element->label[i - labelpos], ANSI_ATTR_BOLD);
+    } else {
+      putCell(view, top, i, ANSI_GLYPH_HLINE, ANSI_ATTR_NORMAL);
+    }
+    putCell(view, bottom, i, ANSI_GLYPH_HLINE, ANSI_ATTR_NORMAL);
+  }
+
+  for (int j = top; j <= bottom; j++) {
+    putCell(view, j, left, ANSI_GLYPH_VLINE, ANSI_ATTR_NORMAL);
+    putCell(view, j, right, ANSI_GLYPH_VLINE, ANSI_ATTR_NORMAL);
+  }
+
+  putCell(view, top, left, ANSI_GLYPH_ULCORNER, ANSI_ATTR_NORMAL);
+  putCell(view, top, right, ANSI_GLYPH_URCORNER, ANSI_ATTR_NORMAL);
+  putCell(view, bottom, left, ANSI_GLYPH_LLCORNER, ANSI_ATTR_NORMAL);
+  putCell(view, bottom, right, ANSI_GLYPH_LRCORNER, ANSI_ATTR_NORMAL);
+}
+
+static AnsiElement_t* findElement(AnsiView_t* view, int handle) {
+  if (!view || handle < 0) return NULL;
+
+  int slot = VIEW_HANDLE_SLOT(handle);
+  if (slot >= ANSI_MAX_ELEMENTS) return NULL;
+
+  AnsiElement_t* element = &view->element[slot];
+  if (!element->used || element->generation != VIEW_HANDLE_GENERATION(handle))
+    return NULL;
+
+  return element;
+}
+
+int appendAnsiElement(AnsiView_t* view, int type, int top, int left,
+                      int height, int width, const char* label) {
+  if (!view || view->free_head < 0) return VIEW_NO_HANDLE;
+
+  int slot = view->free_head;
+  AnsiElement_t* element = &view->element[slot];
+  view->free_head = element->next_free;
+  element->used = true;
+  element->next_free = -1;
+  element->type = type;
+  element->top = top;
+  element->left = left;
+  element->height = height;
+  element->width = width;
+  element->label[0] = '\0';
+  if (label) {
+    strncpy(element->label, label, ANSI_LABEL_SIZE - 1);
+    element->label[ANSI_LABEL_SIZE - 1] = '\0';
+  }
+  ++view->size;
+  renderElementFrame(view, element, false);
+
+  return VIEW_HANDLE(slot, element->generation);
+}
+
+void deleteAnsiElement(AnsiView_t* view, int handle) {
+  AnsiElement_t* element = findElement(view, handle);
+  if (!element) return;
+
+  renderElementFrame(view, element, true);
+  element->used = false;
+  element->generation = (element->generation + 1) & VIEW_GENERATION_MASK;
+  element->next_free = view->free_head;
+  view->free_head = (int)(element - view->element);
+  --view->size;
+  // Рамки соседних элементов могли перекрываться с удаленной.
+  for (int i = 0; i < ANSI_MAX_ELEMENTS; i++) {
+    if (view->element[i].used)
+      renderElementFrame(view, &view->element[i], false);
+  }
+}
+
+static void refreshText(AnsiView_t* view, const AnsiElement_t* element,
+                        const char* text) {
+  int row = element->top + ANSI_DATA_OFFSET;
+  int left = element->left + ANSI_DATA_OFFSET;
+  int width = element->width * ANSI_PIXEL_WIDTH;
+  int length = (int)strlen(text);
+
+  for (int j = 0; j < width; j++) {
+    putCell(view, row, left + j, j < length ? text[j] : ' ', ANSI_ATTR_NORMAL);
+  }
+}
+
+static void refreshMatrix(AnsiView_t* view, const AnsiElement_t* element,
+                          int** matrix) {
+  int top = element->top + ANSI_DATA_OFFSET;
+  int left = element->left + ANSI_DATA_OFFSET;
+
+  for (int i = 0; i < element->height; i++) {
+    for (int j = 0; j < element->width; j++) {
+      uint8_t attr = matrix[i][j] ? ANSI_ATTR_REVERSE : ANSI_ATTR_NORMAL;
+      for (int k = 0; k < ANSI_PIXEL_WIDTH; k++) {
+        putCell(view, top + i, left + j * ANSI_PIXEL_WIDTH + k, ' ', attr);
+      }
+    }
+  }
+}
+
+void refreshAnsiElement(AnsiView_t* view, int handle, int type, void* data) {
+  const AnsiElement_t* element = findElement(view, handle);
+  if (!element || !data) return;
+  if (element->type != type) return;
+
+  char text[ANSI_TEXT_SIZE];
+
+  switch (type) {
+    case DATA_TYPE_INT:
+      snprintf(text, sizeof(text), "%i", *(int*)data);
+      refreshText(view, element, text);
+      break;
+    case DATA_TYPE_INT2D:
+      refreshMatrix(view, element, (int**)data);
+      break;
+    case DATA_TYPE_CHAR:
+      text[0] = *(char*)data;
+      text[1] = '\0';
+      refreshText(view, element, text);
+      break;
+    case DATA_TYPE_STR:
+      snprintf(text, sizeof(text), "%s", (char*)data);
+      refreshText(view, element, text);
+      break;
+    default:
+      break;
+  }
+}
+
+/*!
+  \brief Перемещает курсор терминала в клетку (row, col) кратчайшим способом.
+  \details Небольшой промежуток в той же строке, совпадающий по атрибуту с
+  текущим, перезаписывается неизменными символами, больший — пропускается
+  последовательностью CSI n C, иначе используется абсолютная адресация.
+*/
+static void moveCursor(AnsiView_t* view, int row, int col) {
+  if (row == view->cursorRow && col == view->cursorCol) return;
+
+  if (row == view->cursorRow && col > view->cursorCol) {
+    int gap = col - view->cursorCol;
+    bool plain = gap <= ANSI_MAX_SKIP;
+    for (int j = view->cursorCol; plain && j < col; j++) {
+      AnsiCell_t cell = view->front[row][j];
+      plain = cell.attr == view->attr && (unsigned char)cell.ch >= 0x20;
+    }
+    if (plain) {
+      for (int j = view->cursorCol; j < col; j++) {
+        view->buffer[view->length++] = view->front[row][j].ch;
+      }
+    } else {
+      appendString(view, "\x1b[");
+      appendNumber(view, gap);
+      view->buffer[view->length++] = 'C';
+    }
+  } else {
+    appendString(view, "\x1b[");
+    appendNumber(view, row + 1);
+    view->buffer[view->length++] = ';';
+    appendNumber(view, col + 1);
+    view->buffer[view->length++] = 'H';
+  }
+  view->cursorRow = row;
+  view->cursorCol = col;
+}
+
+static void emitCell(AnsiView_t* view, int row, int col) {
+  AnsiCell_t cell = view->back[row][col];
+
+  if (view->length + ANSI_CELL_RESERVE > ANSI_FRAME_BUFFER_SIZE)
+    flushFrame(view);
+  moveCursor(view, row, col);
+  if (cell.attr != view->attr) {
+    appendString(view, attributes[cell.attr]);
+    view->attr = cell.attr;
+  }
+  if ((unsigned char)cell.ch < 0x20) {
+    appendString(view, glyphs[(int)cell.ch]);
+  } else {
+    view->buffer[view->length++] = cell.ch;
+  }
+  view->front[row][col] = cell;
+  view->cursorCol++;
+  view->stats.cells++;
+}
+
+void renderAnsiView(AnsiView_t* view) {
+  if (!view) return;
+
+  for (int i = 0; i < ANSI_SCREEN_HEIGHT; i++) {
+    for (int j = 0; j < ANSI_SCREEN_WIDTH; j++) {
+      if (!isSameCell(view->back[i][j], view->front[i][j]))
+        emitCell(view, i, j);
+    }
+  }
+  // Единственный вывод кадра на терминал.
+  if (view->length > 0) flushFrame(view);
+  view->stats.frames++;
+}
+
+void invalidateAnsiView(AnsiView_t* view) {
+  if (view) {
+    clearCells(view->front, ANSI_ATTR_INVALID);
+    view->cursorRow = -1;
+    view->attr = ANSI_ATTR_INVALID;
+  }
+}
+
+const AnsiViewStats_t* getAnsiViewStats(const AnsiView_t* view) {
+  return view ? &view->stats : NULL;
+}
+
+void printAnsiViewStats(FILE* stream, const AnsiView_t* view) {
+  if (!stream || !view) return;
+
+  const AnsiViewStats_t* stats = &view->stats;
+  unsigned long frames = stats->frames ? stats->frames : 1;
+
+  fprintf(stream,
+          "frames: %lu\ncells: %lu\nbytes: %lu\nwrites: %lu\n"
+          "bytes/frame: %.1f\nwrites/frame: %.2f\n",
+          stats->frames, stats->cells, stats->bytes, stats->writes,
+          (double)stats->bytes / frames, (double)stats->writes / frames);
+}
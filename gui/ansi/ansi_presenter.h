@@ -0,0 +1,187 @@
+/*!
+  \file ansi_presenter.h
+  \author provemet
+  \version 2
+  \date Октябрь 2026
+  \brief Заголовочный файл представления игр BrickGames на управляющих
+  последовательностях ANSI (без ncurses)
+
+  \details Представление хранит два экранных буфера клеток: back — кадр,
+  формируемый элементами интерфейса, и front — содержимое терминала после
+  последнего вывода. Функция renderAnsiView() сравнивает буферы и записывает
+  в заранее выделенный буфер кадра только изменившиеся клетки, добавляя
+  перемещение курсора и смену атрибутов (SGR) лишь при необходимости. Кадр
+  выводится одним вызовом write(). Все буферы и элементы размещаются в
+  структуре AnsiView_t при ее создании, поэтому формирование и вывод кадра
+  не выделяют память.
+
+  Статистика вывода (AnsiViewStats_t) позволяет сравнить объем вывода и
+  количество системных вызовов с представлением ncurses.
+*/
+
+#ifndef ANSI_PRESENTER_H
+#define ANSI_PRESENTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../view/view_types.h"
+
+#define ERROR_OK 0
+#define ERROR_FAULT 1
+
+/*!
+  \brief Размеры экранного буфера (строк и столбцов терминала)
+  \details Клетки за пределами буфера не выводятся.
+*/
+#define ANSI_SCREEN_HEIGHT 48
+#define ANSI_SCREEN_WIDTH 96
+
+/*!
+  \brief Максимальное количество элементов интерфейса
+*/
+#define ANSI_MAX_ELEMENTS 16
+
+/*!
+  \brief Размер буфера кадра в байтах
+  \details Если изменения кадра не помещаются в буфер, он выводится
+  несколькими вызовами write() (например, при первой отрисовке).
+*/
+#define ANSI_FRAME_BUFFER_SIZE 16384
+
+/*!
+  \brief Максимальная длина (с завершающим нулем) надписи элемента
+*/
+#define ANSI_LABEL_SIZE 16
+
+/*!
+  \brief Максимальная длина (с завершающим нулем) текста данных элемента
+*/
+#define ANSI_TEXT_SIZE 32
+
+#define ANSI_MIN_COORDINATE_VALUE 0
+#define ANSI_MAX_COORDINATE_VALUE 42
+#define ANSI_MIN_ELEMENT_DIM 1
+#define ANSI_DATA_OFFSET 1
+#define ANSI_PIXEL_WIDTH 2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+  \brief Атрибуты отображения клетки
+*/
+typedef enum AnsiAttr {
+  ANSI_ATTR_NORMAL,   ///< Обычный текст
+  ANSI_ATTR_BOLD,     ///< Полужирный текст (надписи)
+  ANSI_ATTR_REVERSE,  ///< Инверсия (заполненная клетка поля)
+  ANSI_ATTR_INVALID = 0xff  ///< Содержимое клетки терминала неизвестно
+} AnsiAttr;
+
+/*!
+  \brief Символы рамки
+  \details Коды меньше 0x20 в клетке обозначают символы псевдографики,
+  выводимые в UTF-8.
+*/
+typedef enum AnsiGlyph {
+  ANSI_GLYPH_HLINE = 1,  ///< Горизонтальная линия
+  ANSI_GLYPH_VLINE,      ///< Вертикальная линия
+  ANSI_GLYPH_ULCORNER,   ///< Левый верхний угол
+  ANSI_GLYPH_URCORNER,   ///< Правый верхний угол
+  ANSI_GLYPH_LLCORNER,   ///< Левый нижний угол
+  ANSI_GLYPH_LRCORNER    ///< Правый нижний угол
+} AnsiGlyph;
+
+/*!
+  \brief Клетка экранного буфера
+*/
+typedef struct AnsiCell_t {
+  char ch;        ///< Символ или код псевдографики (AnsiGlyph)
+  uint8_t attr;   ///< Атрибут отображения (AnsiAttr)
+} AnsiCell_t;
+
+/*!
+  \brief Элемент интерфейса
+  \details Геометрия элемента совпадает с представлением ncurses: рамка
+  занимает (height + 2) строк и (width + 2) * ANSI_PIXEL_WIDTH столбцов,
+  данные выводятся внутри рамки.
+*/
+typedef struct AnsiElement_t {
+  int type;    ///< Хранимый тип данных (enum DataType)
+  int top;     ///< Строка левого верхнего угла элемента
+  int left;    ///< Столбец левого верхнего угла элемента
+  int width;   ///< Горизонтальный размер элемента (в клетках поля)
+  int height;  ///< Вертикальный размер элемента
+  char label[ANSI_LABEL_SIZE];  ///< Надпись элемента
+  bool used;            ///< Признак занятой ячейки
+  unsigned generation;  ///< Поколение ячейки (см. VIEW_HANDLE)
+  int next_free;        ///< Следующая свободная ячейка (-1 — нет)
+} AnsiElement_t;
+
+/*!
+  \brief Статистика вывода представления
+*/
+typedef struct AnsiViewStats_t {
+  unsigned long frames;  ///< Количество выведенных кадров
+  unsigned long cells;   ///< Количество выведенных клеток
+  unsigned long bytes;   ///< Количество выведенных байт
+  unsigned long writes;  ///< Количество вызовов write()
+} AnsiViewStats_t;
+
+/*!
+  \brief Структура представления ANSI
+*/
+typedef struct AnsiView_t {
+  int fd;  ///< Дескриптор вывода (-1 — кадр только формируется в буфере)
+  AnsiElement_t element[ANSI_MAX_ELEMENTS];  ///< Ячейки элементов
+  size_t size;    ///< Количество элементов
+  int free_head;  ///< Первая свободная ячейка (-1 — нет)
+  AnsiCell_t back[ANSI_SCREEN_HEIGHT][ANSI_SCREEN_WIDTH];   ///< Новый кадр
+  AnsiCell_t front[ANSI_SCREEN_HEIGHT][ANSI_SCREEN_WIDTH];  ///< Терминал
+  int cursorRow;    ///< Строка курсора терминала (-1 — неизвестна)
+  int cursorCol;    ///< Столбец курсора терминала
+  uint8_t attr;     ///< Текущий атрибут терминала
+  char buffer[ANSI_FRAME_BUFFER_SIZE];  ///< Буфер кадра
+  size_t length;    ///< Длина сформированной части кадра
+  AnsiViewStats_t stats;  ///< Статистика вывода
+} AnsiView_t;
+
+/*!
+  \defgroup Ansi_data_structure_management Функции управления структурами
+  данных представления ANSI
+*/
+AnsiView_t* initAnsiView(int fd);
+void freeAnsiView(AnsiView_t* view);
+
+/*!
+  \defgroup Ansi_data_structure_manipulation Функции манипуляции элементами
+  \details Элементы адресуются дескрипторами с поколением (VIEW_HANDLE), как
+  в представлении ncurses. Добавление и удаление элемента сразу изменяет
+  рамки в буфере кадра; refreshAnsiElement() записывает данные элемента в
+  буфер кадра без вывода на терминал.
+*/
+int appendAnsiElement(AnsiView_t* view, int type, int top, int left,
+                      int height, int width, const char* label);
+void deleteAnsiElement(AnsiView_t* view, int handle);
+void refreshAnsiElement(AnsiView_t* view, int handle, int type, void* data);
+
+/*!
+  \defgroup Ansi_graphic_functions Функции визуализации
+  \details renderAnsiView() выводит отличия кадра от терминала одним вызовом
+  write(). invalidateAnsiView() объявляет содержимое терминала неизвестным
+  (например, после изменения размера окна): следующий кадр выводится
+  полностью.
+*/
+void renderAnsiView(AnsiView_t* view);
+void invalidateAnsiView(AnsiView_t* view);
+const AnsiViewStats_t* getAnsiViewStats(const AnsiView_t* view);
+void printAnsiViewStats(FILE* stream, const AnsiView_t* view);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
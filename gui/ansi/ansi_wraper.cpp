@@ -0,0 +1,26 @@
+#include "ansi_wraper.hpp"
+
+#include <unistd.h>
+
+s21::AnsiViewWrapper::AnsiViewWrapper() {
+  this->ansiView = initAnsiView(STDOUT_FILENO);
+}
+
+s21::AnsiViewWrapper::~AnsiViewWrapper() { freeAnsiView(this->ansiView); }
+
+int s21::AnsiViewWrapper::addElement(int type, int top, int left, int width,
+                                     int height, const char* label) {
+  return appendAnsiElement(this->ansiView, type, top, left, height, width,
+                           label);
+}
+
+void s21::AnsiViewWrapper::deleteElement(int handle) {
+  deleteAnsiElement(this->ansiView, handle);
+}
+
+void s21::AnsiViewWrapper::refreshElemenet(int handle, int datatype,
+                                           void* data) {
+  refreshAnsiElement(this->ansiView, handle, datatype, data);
+}
+
+void s21::AnsiViewWrapper::render() { renderAnsiView(this->ansiView); }
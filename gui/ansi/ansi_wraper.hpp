@@ -0,0 +1,27 @@
+#pragma once
+
+#include "../view/view.hpp"
+#include "ansi_presenter.h"
+namespace s21 {
+
+/*!
+    \brief Представление игр BrickGame на управляющих последовательностях ANSI
+    \details Реализация ViewInterface без ncurses: кадр формируется в
+   заранее выделенном буфере и выводится на терминал одним вызовом write().
+*/
+class AnsiViewWrapper : public s21::ViewInterface {
+ public:
+  AnsiViewWrapper();
+  ~AnsiViewWrapper() override;
+
+  int addElement(int type, int top, int left, int width, int height,
+                 const char* label) override;
+  void deleteElement(int handle) override;
+  void refreshElemenet(int handle, int datatype, void* data) override;
+  void render() override;
+
+ private:
+  AnsiView_t* ansiView;
+};
+
+}  // namespace s21
@@ -1,22 +1,51 @@
 #include "cli_presenter.h"
 
-void initNcurses() {
-  initscr();
-  cbreak();
-  noecho();
-  keypad(stdscr, TRUE);
-  curs_set(0);
+static SCREEN* initNcurses(const char* term, FILE* output) {
+  SCREEN* screen = newterm(term, output, stdin);
+
+  if (screen) {
+    cbreak();
+    noecho();
+    keypad(stdscr, TRUE);
+    curs_set(0);
+  }
+
+  return screen;
 }
 
-void freeNCurses() { endwin(); }
+static void freeNCurses(SCREEN* screen) {
+  set_term(screen);
+  endwin();
+  delscreen(screen);
+}
 
-ConsoleView_t* initView() {
+ConsoleView_t* initView() { return initViewStream(NULL, stdout); }
+
+ConsoleView_t* initViewStream(const char* term, FILE* output) {
   ConsoleView_t* consoleView = NULL;
 
-  if ((consoleView = (ConsoleView_t*)malloc(sizeof(ConsoleView_t))) != NULL) {
-    initNcurses();
+  if ((consoleView = (ConsoleView_t*)malloc(sizeof(ConsoleView_t))) != NULL &&
+      (consoleView->screen = initNcurses(term, output)) == NULL) {
+    free(consoleView);
+    consoleView = NULL;
+  }
+  if (consoleView) {
     consoleView->size = (size_t)0;
-    consoleView->element = NULL;
+    consoleView->free_head = 0;
+    consoleView->labels_size = 0;
+    for (int i = 0; i < VIEW_MAX_ELEMENTS; i++) {
+      ConsoleElement_t* element = &consoleView->element[i];
+      element->used = false;
+      element->generation = 0;
+      element->next_free = i + 1 < VIEW_MAX_ELEMENTS ? i + 1 : -1;
+      element->shadow = NULL;
+      element->shadow_capacity = 0;
+      element->window = NULL;
+    }
+    consoleView->chrome = newwin(0, 0, 0, 0);
+    consoleView->layout_changed = true;
+    consoleView->lines = LINES;
+    consoleView->cols = COLS;
   }
 
   return consoleView;
@@ -24,14 +53,16 @@ ConsoleView_t* initView() {
 
 void freeView(ConsoleView_t* view) {
   if (view) {
-    for (int i = view->size - 1; i >= 0; i--) {
-      deleteViewElement(view, i);
+    for (int i = 0; i < VIEW_MAX_ELEMENTS; i++) {
+      free(view->element[i].shadow);
+      if (view->element[i].window) delwin(view->element[i].window);
     }
+    if (view->chrome) delwin(view->chrome);
+    freeNCurses(view->screen);
+    if (locateView(NULL) == view) locateView(view);
     free(view);
-    locateView(view);
     view = NULL;
   }
-  freeNCurses();
 }
 
 /*!
@@ -67,62 +98,125 @@ ConsoleView_t* locateView(ConsoleView_t* view) {
   return locator.view;
 }
 
-int appendViewElement(ConsoleView_t* view, int type, int top, int left,
-                      int height, int width, char* label) {
-  int errval = ERROR_FAULT;
+/*!
+  \brief Возвращает надпись из пула надписей, добавляя ее при отсутствии.
+  \return Указатель на надпись в пуле или NULL, если пул заполнен.
+*/
+static const char* internLabel(ConsoleView_t* view, const char* label) {
+  size_t offset = 0;
 
-  //Проверка условий исполнения функции.
-  if (!view) return errval;
-
-  size_t newsize = view->size + 1;
-  ConsoleElement_t* elements;
-  elements = (ConsoleElement_t*)realloc(view->element,
-                                        newsize * sizeof(ConsoleElement_t));
-
-  if (elements) {
-    elements[newsize - 1].top = top;
-    elements[newsize - 1].left = left;
-    elements[newsize - 1].height = height;
-    elements[newsize - 1].width = width;
-    if (label) {
-      elements[newsize - 1].label =
-          (char*)malloc(sizeof(char) * (int)(strlen(label) + 1));
-      for (int j = 0; j <= strlen(label); j++) {
-        elements[newsize - 1].label[j] = label[j];
-      }
-    } else {
-      elements[newsize - 1].label = NULL;
-    }
+  while (offset < view->labels_size) {
+    const char* interned = view->labels + offset;
+    if (!strcmp(interned, label)) return interned;
+    offset += strlen(interned) + 1;
+  }
+
+  size_t length = strlen(label) + 1;
+  if (view->labels_size + length > VIEW_LABEL_POOL_SIZE) return NULL;
 
-    view->element = elements;
-    view->size = newsize;
-    errval = ERROR_OK;
+  char* interned = view->labels + view->labels_size;
+  memcpy(interned, label, length);
+  view->labels_size += length;
+
+  return interned;
+}
+
+/*!
+  \brief Подготавливает окно данных и теневой буфер ячейки.
+  \details Окно и буфер, оставшиеся от удаленного элемента, используются
+  повторно; память выделяется только при их отсутствии или нехватке емкости.
+*/
+static int prepareElementBuffers(ConsoleElement_t* element) {
+  if (element->height < MIN_ELEMENT_DIM || element->width < MIN_ELEMENT_DIM)
+    return ERROR_OK;
+
+  size_t cells = (size_t)element->height * element->width;
+  if (cells > element->shadow_capacity) {
+    int* shadow = (int*)realloc(element->shadow, cells * sizeof(int));
+    if (!shadow) return ERROR_FAULT;
+    element->shadow = shadow;
+    element->shadow_capacity = cells;
+  }
+  memset(element->shadow, 0, cells * sizeof(int));
+
+  int top = element->top + ELEMENT_DATA_OFFSET;
+  int left = element->left + ELEMENT_DATA_OFFSET;
+  int width = element->width * PIXEL_WIDTH;
+  if (element->window && (wresize(element->window, element->height, width) ||
+                          mvwin(element->window, top, left))) {
+    delwin(element->window);
+    element->window = NULL;
+  }
+  if (element->window) {
+    werase(element->window);
+  } else {
+    element->window = newwin(element->height, width, top, left);
   }
 
-  return errval;
+  return ERROR_OK;
 }
 
-void deleteViewElement(ConsoleView_t* view, int index) {
-  if (!view) return;
-  if (!view->element) return;
-  if (index < 0 || index > view->size - 1) return;
+/*!
+  \brief Возвращает элемент по дескриптору или NULL для недействительного.
+*/
+static ConsoleElement_t* findElement(ConsoleView_t* view, int handle) {
+  if (!view || handle < 0) return NULL;
 
-  if (view->element[index].label) free(view->element[index].label);
+  int slot = VIEW_HANDLE_SLOT(handle);
+  if (slot >= VIEW_MAX_ELEMENTS) return NULL;
 
-  for (int i = index; i < view->size - 1; i++) {
-    view->element[i] = view->element[i + 1];
-  }
+  ConsoleElement_t* element = &view->element[slot];
+  if (!element->used || element->generation != VIEW_HANDLE_GENERATION(handle))
+    return NULL;
+
+  return element;
+}
+
+int appendViewElement(ConsoleView_t* view, int type, int top, int left,
+                      int height, int width, const char* label) {
+  //Проверка условий исполнения функции.
+  if (!view || view->free_head < 0) return VIEW_NO_HANDLE;
+
+  const char* interned = NULL;
+  if (label && (interned = internLabel(view, label)) == NULL)
+    return VIEW_NO_HANDLE;
+
+  int slot = view->free_head;
+  ConsoleElement_t* element = &view->element[slot];
+  element->type = type;
+  element->top = top;
+  element->left = left;
+  element->height = height;
+  element->width = width;
+  element->label = interned;
+  element->is_changes = true;
+  element->text[0] = '\0';
+  if (prepareElementBuffers(element)) return VIEW_NO_HANDLE;
+
+  view->free_head = element->next_free;
+  element->used = true;
+  element->next_free = -1;
+  ++view->size;
+  view->layout_changed = true;
+
+  return VIEW_HANDLE(slot, element->generation);
+}
 
+void deleteViewElement(ConsoleView_t* view, int handle) {
+  ConsoleElement_t* element = findElement(view, handle);
+  if (!element) return;
+
+  // Окно и теневой буфер остаются в ячейке для следующего элемента.
+  element->used = false;
+  element->generation = (element->generation + 1) & VIEW_GENERATION_MASK;
+  element->next_free = view->free_head;
+  view->free_head = (int)(element - view->element);
   --view->size;
-  if (view->size > 0) {
-    view->element = (ConsoleElement_t*)realloc(
-        view->element, sizeof(ConsoleElement_t) * (view->size));
-  } else {
-    free(view->element);
-  }
+  view->layout_changed = true;
 }
 
-void renderElementFrame(const ConsoleElement_t element) {
+static void renderElementFrame(WINDOW* chrome,
+                               const ConsoleElement_t element) {
   if (element.height < MIN_ELEMENT_DIM || element.width < MIN_ELEMENT_DIM)
     return;
 
@@ -154,70 +248,131 @@ void renderElementFrame(const ConsoleElement_t element) {
 
   for (int i = left; i < left + width * PIXEL_WIDTH; i++) {
     if (labelLength > 0 && i >= labelpos && i < labelpos + labelLength) {
-      mvaddch(top, i, element.label[i - labelpos]);
+      mvwaddch(chrome, top, i, element.label[i - labelpos]);
     } else {
-      mvaddch(top, i, ACS_HLINE);
+      mvwaddch(chrome, top, i, ACS_HLINE);
     }
-    mvaddch(top + height - 1, i, ACS_HLINE);
+    mvwaddch(chrome, top + height - 1, i, ACS_HLINE);
   }
 
   for (int j = top; j < top + height; j++) {
-    mvaddch(j, left, ACS_VLINE);
-    mvaddch(j, left + (width * PIXEL_WIDTH) - 1, ACS_VLINE);
+    mvwaddch(chrome, j, left, ACS_VLINE);
+    mvwaddch(chrome, j, left + (width * PIXEL_WIDTH) - 1, ACS_VLINE);
+  }
+
+  mvwaddch(chrome, top, left, ACS_ULCORNER);
+  mvwaddch(chrome, top, left + (width * PIXEL_WIDTH) - 1, ACS_URCORNER);
+  mvwaddch(chrome, top + height - 1, left, ACS_LLCORNER);
+  mvwaddch(chrome, top + height - 1, left + (width * 2) - 1, ACS_LRCORNER);
+}
+
+void renderView(ConsoleView_t* view) {
+  if (!view) return;
+
+  if (view->lines != LINES || view->cols != COLS) {
+    view->lines = LINES;
+    view->cols = COLS;
+    view->layout_changed = true;
+    if (view->chrome) wresize(view->chrome, LINES, COLS);
+    clearok(curscr, TRUE);
+  }
+
+  // Оформление перерисовывается только при изменении раскладки; окна данных
+  // при этом переносятся на виртуальный экран целиком поверх оформления.
+  if (view->layout_changed && view->chrome) {
+    werase(view->chrome);
+    for (int i = 0; i < VIEW_MAX_ELEMENTS; i++) {
+      if (view->element[i].used)
+        renderElementFrame(view->chrome, view->element[i]);
+    }
+    wnoutrefresh(view->chrome);
+    for (int i = 0; i < VIEW_MAX_ELEMENTS; i++) {
+      if (view->element[i].used && view->element[i].window)
+        touchwin(view->element[i].window);
+    }
+    view->layout_changed = false;
   }
 
-  mvaddch(top, left, ACS_ULCORNER);
-  mvaddch(top, left + (width * PIXEL_WIDTH) - 1, ACS_URCORNER);
-  mvaddch(top + height - 1, left, ACS_LLCORNER);
-  mvaddch(top + height - 1, left + (width * 2) - 1, ACS_LRCORNER);
-  refresh();
+  for (int i = 0; i < VIEW_MAX_ELEMENTS; i++) {
+    WINDOW* window = view->element[i].window;
+    if (view->element[i].used && window && is_wintouched(window))
+      wnoutrefresh(window);
+  }
+  // Единственное обновление терминала за кадр.
+  doupdate();
 }
 
-void renderView(const ConsoleView_t* view) {
+void invalidateView(ConsoleView_t* view) {
   if (view) {
-    for (int i = 0; i < view->size; i++) {
-      renderElementFrame(view->element[i]);
+    for (int i = 0; i < VIEW_MAX_ELEMENTS; i++) {
+      view->element[i].is_changes = true;
+    }
+    view->layout_changed = true;
+  }
+}
+
+/*!
+  \brief Выводит клетки матрицы, отличающиеся от теневого буфера.
+*/
+static void refreshMatrix(ConsoleElement_t* element, int** matrix) {
+  for (int i = 0; i < element->height; i++) {
+    int* shadow = element->shadow + (size_t)i * element->width;
+    for (int j = 0; j < element->width; j++) {
+      int value = matrix[i][j];
+      if (element->is_changes || shadow[j] != value) {
+        mvwaddstr(element->window, i, j * PIXEL_WIDTH,
+                  value ? PIXEL_FILLED : PIXEL_EMPTY);
+        shadow[j] = value;
+      }
     }
   }
 }
 
-void refreshViewElement(ConsoleView_t* view, int index, int type, void* data) {
-  if (!view || !data) return;
-  if (index < 0 || index >= view->size) return;
-  if (view->element[index].type != type) return;
+/*!
+  \brief Выводит текст, если он отличается от теневого буфера.
+  \details Остаток ранее выведенного более длинного текста затирается
+  пробелами.
+*/
+static void refreshText(ConsoleElement_t* element, const char* text) {
+  if (!element->is_changes && !strcmp(element->text, text)) return;
+
+  int length = (int)strlen(text);
+  int previous = (int)strlen(element->text);
+  mvwaddstr(element->window, 0, 0, text);
+  for (int i = length; i < previous; i++) {
+    mvwaddch(element->window, 0, i, ' ');
+  }
+  strncpy(element->text, text, ELEMENT_TEXT_SIZE - 1);
+  element->text[ELEMENT_TEXT_SIZE - 1] = '\0';
+}
+
+void refreshViewElement(ConsoleView_t* view, int handle, int type,
+                        void* data) {
+  ConsoleElement_t* element = findElement(view, handle);
+  if (!element || !data) return;
+  if (element->type != type || !element->window) return;
 
-  int top = view->element[index].top + ELEMENT_DATA_OFFSET;
-  int left = view->element[index].left + ELEMENT_DATA_OFFSET;
+  char text[ELEMENT_TEXT_SIZE];
 
   switch (type) {
-    case DATA_TYPE_INT: {
-      int value = *(int*)data;
-      mvprintw(top, left, "%i", value);
+    case DATA_TYPE_INT:
+      snprintf(text, sizeof(text), "%i", *(int*)data);
+      refreshText(element, text);
       break;
-    }
-    case DATA_TYPE_INT2D: {
-      int** matrix = (int**)data;
-      for (int i = 0; i < view->element[index].height; i++) {
-        for (int j = 0; j < view->element[index].width; j++) {
-          if (matrix[i][j] == 0) {
-            mvprintw(top + i, left + j * PIXEL_WIDTH, "%s", "  ");
-          } else {
-            mvprintw(top + i, left + j * PIXEL_WIDTH, "%s", "[]");
-          }
-        }
-      }
+    case DATA_TYPE_INT2D:
+      if (element->shadow) refreshMatrix(element, (int**)data);
       break;
-    }
-    case DATA_TYPE_CHAR: {
-      mvprintw(top, left, "%c", *(char*)data);
+    case DATA_TYPE_CHAR:
+      text[0] = *(char*)data;
+      text[1] = '\0';
+      refreshText(element, text);
       break;
-    }
-    case DATA_TYPE_STR: {
-      mvprintw(top, left, "%s", (char*)data);
+    case DATA_TYPE_STR:
+      snprintf(text, sizeof(text), "%s", (char*)data);
+      refreshText(element, text);
       break;
-    }
     default:
       break;
   }
-  refresh();
-}
\ No newline at end of file
+  element->is_changes = false;
+}
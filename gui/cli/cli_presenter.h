@@ -18,6 +18,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../view/view_types.h"
+
 #define ERROR_OK 0
 #define ERROR_FAULT 1
 
@@ -57,22 +59,33 @@
 #define ELEMENT_DATA_OFFSET 1
 #define PIXEL_WIDTH 2
 
-#ifdef __cplusplus
-extern "C" {
-#endif
+/*!
+  \brief Размер теневого буфера текста элемента
+  \details Макрос определяет максимальную длину (с завершающим нулем) текста,
+  выводимого элементами с данными DATA_TYPE_INT, DATA_TYPE_CHAR и
+  DATA_TYPE_STR.
+*/
+#define ELEMENT_TEXT_SIZE 32
 
 /*!
-  \brief Перечисление типов данных элемента
-  \details Перечисление используется в определении типа данных в структуре
-  ConsoleElement_t, а также в функции обновления изображения.
+  \brief Емкость хранилища элементов представления
+  \details Элементы хранятся в массиве ячеек фиксированного размера
+  (не более VIEW_HANDLE_SLOT_MASK + 1).
 */
-typedef enum DataType {
-  DATA_TYPE_INT,    ///< Целое число
-  DATA_TYPE_INT1D,  ///< Одномерный массив целых чисел
-  DATA_TYPE_INT2D,  ///< Двумерный массив (матрица)
-  DATA_TYPE_CHAR,   ///< Символ
-  DATA_TYPE_STR     ///< Строка
-} DataType;
+#define VIEW_MAX_ELEMENTS 32
+
+/*!
+  \brief Размер пула надписей элементов (в байтах)
+  \details Одинаковые надписи хранятся в пуле однократно.
+*/
+#define VIEW_LABEL_POOL_SIZE 256
+
+#define PIXEL_FILLED "[]"
+#define PIXEL_EMPTY "  "
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /*!
     \brief Структура представления элемента интерфейса.
@@ -87,18 +100,43 @@ typedef struct ConsoleElement_t {
              ///< угла элемента.
   int width;   ///< Горизонтальный размер элемента
   int height;  ///< Вертикальный размер элемента
-  bool is_changes;  //Пока пусть будет.
-  char* label;  ///< Строка надписи (метки) элемента
+  bool is_changes;  ///< Признак полной перерисовки данных элемента (теневой
+                    ///< буфер недействителен)
+  const char* label;  ///< Строка надписи (метки) элемента в пуле надписей
+  int* shadow;  ///< Теневой буфер: последние выведенные значения клеток
+                ///< матрицы (height x width, DATA_TYPE_INT2D)
+  size_t shadow_capacity;  ///< Емкость теневого буфера (клеток)
+  char text[ELEMENT_TEXT_SIZE];  ///< Теневой буфер: последний выведенный
+                                 ///< текст (DATA_TYPE_INT, CHAR, STR)
+  WINDOW* window;  ///< Окно данных элемента (внутри рамки)
+  bool used;  ///< Признак занятой ячейки хранилища
+  unsigned generation;  ///< Поколение ячейки (см. VIEW_HANDLE)
+  int next_free;  ///< Следующая свободная ячейка (-1 — нет)
 } ConsoleElement_t;
 
 /*!
     \brief Структура хранения элементов (ConsoleElement_t) интерфейса.
-    \details Структура предназначена для хранения массива элементов
-   интерфейса представления, а также его размерности.
+    \details Структура предназначена для хранения элементов интерфейса
+   представления в массиве ячеек фиксированной емкости. Свободные ячейки
+   связаны в список, поэтому добавление и удаление элемента выполняются за
+   O(1), а ячейка хранит окно и теневой буфер удаленного элемента для
+   повторного использования. Элементы адресуются дескрипторами с поколением
+   (VIEW_HANDLE), которые не меняются при удалении других элементов.
+   Статическое оформление
+   (рамки и надписи элементов) рисуется в отдельное окно chrome только при
+   изменении раскладки или размера терминала.
 */
 typedef struct ConsoleView_t {
-  ConsoleElement_t* element;  ///< Массив элементов интерфейса.
-  size_t size;  ///< Размерность массива элементов интерфейса.
+  ConsoleElement_t element[VIEW_MAX_ELEMENTS];  ///< Ячейки элементов.
+  size_t size;  ///< Количество элементов интерфейса.
+  int free_head;  ///< Первая свободная ячейка (-1 — нет)
+  char labels[VIEW_LABEL_POOL_SIZE];  ///< Пул надписей элементов
+  size_t labels_size;  ///< Занятая часть пула надписей
+  SCREEN* screen;  ///< Экран ncurses представления
+  WINDOW* chrome;  ///< Окно статического оформления (рамки, надписи)
+  bool layout_changed;  ///< Признак необходимости перерисовки оформления
+  int lines;  ///< Высота терминала при последней отрисовке оформления
+  int cols;   ///< Ширина терминала при последней отрисовке оформления
 } ConsoleView_t;
 
 /*!
@@ -116,8 +154,13 @@ typedef struct ViewLocator_t {
 /*!
   \defgroup Data_structure_management Функции управления структурами данных
   \brief Функции предназначенные для создания и уничтожения структур данных.
+  \details initView() выводит интерфейс на терминал стандартного вывода.
+  initViewStream() выводит его в поток output для терминала типа term (NULL
+  — из переменной TERM), например в /dev/null для замеров формирования
+  кадра. Функции возвращают NULL, если экран ncurses не создан.
 */
 ConsoleView_t* initView();
+ConsoleView_t* initViewStream(const char* term, FILE* output);
 void freeView(ConsoleView_t* view);
 
 /*!
@@ -130,20 +173,31 @@ ConsoleView_t* locateView(ConsoleView_t* view);
     \defgroup Data_structure_manipulation Функции манипуляции данными структур
     \brief Функции предназначенные для управления данными, хранимых в
    структурах.
+    \details appendViewElement() возвращает дескриптор элемента или
+   VIEW_NO_HANDLE, если хранилище или пул надписей заполнены. Функции
+   deleteViewElement() и refreshViewElement() игнорируют недействительные
+   дескрипторы (в том числе дескрипторы удаленных элементов).
 */
 int appendViewElement(ConsoleView_t* view, int type, int top, int left,
-                      int height, int width, char* label);
-void deleteViewElement(ConsoleView_t* view, int index);
-void refreshViewElement(ConsoleView_t* view, int index, int type, void* data);
+                      int height, int width, const char* label);
+void deleteViewElement(ConsoleView_t* view, int handle);
+void refreshViewElement(ConsoleView_t* view, int handle, int type, void* data);
 
 /*!
     \details Graphic_functions Функции визуализации интерфейса.
     \brief Функции предназначенные для визуализации интерфейса и его изменения
    на экране.
+
+    \details Функция refreshViewElement() сравнивает новые данные элемента с
+   теневым буфером и выводит в окно данных элемента только изменившиеся
+   клетки, не обновляя экран. Функция renderView() завершает кадр: переносит
+   на виртуальный экран только измененные окна данных и выполняет одно
+   обновление терминала (doupdate) на кадр. Рамки и надписи перерисовываются
+   только при изменении раскладки (добавление или удаление элемента,
+   invalidateView()) или размера терминала.
 */
-void renderView(const ConsoleView_t* view);
-// void renderElementFrame(ConsoleElement_t* element);
-//Добавить рендеринг обновленного состояния элемента
+void renderView(ConsoleView_t* view);
+void invalidateView(ConsoleView_t* view);
 
 #ifdef __cplusplus
 }
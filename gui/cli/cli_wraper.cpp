@@ -10,18 +10,19 @@ s21::ConsoleViewWrapper::~ConsoleViewWrapper() {
   freeView(this->consoleView);
 }
 
-void s21::ConsoleViewWrapper::addElement(int type, int top, int left, int width,
-                                         int height, char* label) {
-  appendViewElement(this->consoleView, type, top, left, height, width, label);
+int s21::ConsoleViewWrapper::addElement(int type, int top, int left, int width,
+                                        int height, const char* label) {
+  return appendViewElement(this->consoleView, type, top, left, height, width,
+                           label);
 }
 
-void s21::ConsoleViewWrapper::deleteElement(int index) {
-  deleteViewElement(this->consoleView, index);
+void s21::ConsoleViewWrapper::deleteElement(int handle) {
+  deleteViewElement(this->consoleView, handle);
 }
 
-void s21::ConsoleViewWrapper::refreshElemenet(int index, int datatype,
+void s21::ConsoleViewWrapper::refreshElemenet(int handle, int datatype,
                                             void* data) {
-  refreshViewElement(this->consoleView, index, datatype, data);
+  refreshViewElement(this->consoleView, handle, datatype, data);
 }
 
 void s21::ConsoleViewWrapper::render() { renderView(this->consoleView); }
@@ -9,10 +9,10 @@ class ConsoleViewWrapper : public s21::ViewInterface {
   ConsoleViewWrapper();
   ~ConsoleViewWrapper() override;
 
-  void addElement(int type, int top, int left, int width, int height,
-                  char* label) override;
-  void deleteElement(int index) override;
-  void refreshElemenet(int index, int datatype, void* data) override;
+  int addElement(int type, int top, int left, int width, int height,
+                 const char* label) override;
+  void deleteElement(int handle) override;
+  void refreshElemenet(int handle, int datatype, void* data) override;
   void render() override;
 
  private:
@@ -1,2 +1,440 @@
 #include "dsk_presenter.hpp"
 
+#include <QMetaObject>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const QColor kBackground(0x18, 0x18, 0x20);
+const QColor kForeground(0xb0, 0xb0, 0xb8);
+const QColor kLabelColor(0xff, 0xff, 0xff);
+
+// Цвета тайлов атласа, тайл 0 — пустая клетка.
+const QRgb kTilePalette[s21::kDesktopTileColors] = {
+    qRgb(0x24, 0x24, 0x2e), qRgb(0x00, 0xbc, 0xd4), qRgb(0x3f, 0x51, 0xb5),
+    qRgb(0xff, 0x98, 0x00), qRgb(0xff, 0xeb, 0x3b), qRgb(0x4c, 0xaf, 0x50),
+    qRgb(0x9c, 0x27, 0xb0), qRgb(0xf4, 0x43, 0x36)};
+
+// Толщина линии рамки и ширина фаски тайла, пиксели.
+constexpr int kFrameLine = 2;
+constexpr int kBevel = 3;
+
+int tileIndex(int value) {
+  if (value < 0) return 0;
+  return std::min(value, s21::kDesktopTileColors - 1);
+}
+
+}  // namespace
+
+s21::QtView::QtView(QWidget* parent) : QWidget(parent) {
+  // Окно целиком закрывается буфером и полями, очищать фон не нужно.
+  setAttribute(Qt::WA_OpaquePaintEvent);
+  setAttribute(Qt::WA_NoSystemBackground);
+  textFont = QFont(QStringLiteral("monospace"));
+  textFont.setStyleHint(QFont::Monospace);
+  textFont.setPixelSize(kDesktopCharHeight * 2 / 3);
+  buildAtlas();
+}
+
+void s21::QtView::buildAtlas() {
+  atlas = QImage(kDesktopTileSize * kDesktopTileColors, kDesktopTileSize,
+                 QImage::Format_RGB32);
+  atlas.fill(kBackground);
+
+  QPainter painter(&atlas);
+  for (int i = 0; i < kDesktopTileColors; i++) {
+    QColor color = QColor::fromRgb(kTilePalette[i]);
+    QRect face(i * kDesktopTileSize + 1, 1, kDesktopTileSize - 2,
+               kDesktopTileSize - 2);
+    if (i == 0) {
+      painter.fillRect(face, color);
+      continue;
+    }
+    painter.fillRect(face, color.lighter(140));
+    painter.fillRect(face.adjusted(kBevel, kBevel, 0, 0), color.darker(140));
+    painter.fillRect(face.adjusted(kBevel, kBevel, -kBevel, -kBevel), color);
+  }
+}
+
+QRect s21::QtView::frameRect(const QtElement& element) const {
+  return QRect(element.left * kDesktopCharWidth,
+               element.top * kDesktopCharHeight,
+               (element.width * 2 + 2) * kDesktopCharWidth,
+               (element.height + 2) * kDesktopCharHeight);
+}
+
+QRect s21::QtView::dataRect(const QtElement& element) const {
+  int rows = element.type == DATA_TYPE_INT2D ? element.height : 1;
+
+  return QRect((element.left + 1) * kDesktopCharWidth,
+               (element.top + 1) * kDesktopCharHeight,
+               element.width * kDesktopTileSize, rows * kDesktopCharHeight);
+}
+
+void s21::QtView::growCanvas(const QRect& bounds) {
+  if (canvas.rect().contains(bounds)) return;
+
+  QImage grown(std::max(canvas.width(), bounds.right() + 1),
+               std::max(canvas.height(), bounds.bottom() + 1),
+               QImage::Format_RGB32);
+  grown.fill(kBackground);
+  if (!canvas.isNull()) {
+    QPainter painter(&grown);
+    painter.drawImage(0, 0, canvas);
+  }
+  canvas = grown;
+  resized = true;
+}
+
+void s21::QtView::drawFrame(const QtElement& element, bool erase) {
+  QRect box = frameRect(element);
+  QPainter painter(&canvas);
+
+  pending += box;
+  if (erase) {
+    painter.fillRect(box, kBackground);
+    return;
+  }
+
+  // Линия рамки проходит через середину крайних знакомест, как символы
+  // псевдографики в терминальных представлениях.
+  painter.setPen(QPen(kForeground, kFrameLine));
+  painter.drawRect(box.adjusted(kDesktopCharWidth / 2, kDesktopCharHeight / 2,
+                                -kDesktopCharWidth / 2,
+                                -kDesktopCharHeight / 2));
+  if (element.label.empty()) return;
+
+  QString label = QString::fromStdString(element.label);
+  painter.setFont(textFont);
+  int labelWidth = painter.fontMetrics().boundingRect(label).width();
+  int width = std::min(labelWidth + kDesktopCharWidth,
+                       box.width() - 2 * kDesktopCharWidth);
+  QRect labelBox(box.left() + (box.width() - width) / 2, box.top(), width,
+                 kDesktopCharHeight);
+  painter.fillRect(labelBox, kBackground);
+  painter.setPen(kLabelColor);
+  painter.drawText(labelBox, Qt::AlignCenter, label);
+}
+
+void s21::QtView::paintText(const QtElement& element) {
+  QRect box = dataRect(element);
+  QPainter painter(&canvas);
+
+  painter.fillRect(box, kBackground);
+  painter.setFont(textFont);
+  painter.setPen(kForeground);
+  painter.drawText(box, Qt::AlignLeft | Qt::AlignVCenter,
+                   QString::fromStdString(element.text));
+  pending += box;
+}
+
+void s21::QtView::drawText(QtElement& element, const std::string& text) {
+  if (text == element.text) return;
+
+  element.text = text;
+  paintText(element);
+}
+
+void s21::QtView::blitTile(int x, int y, int value) {
+  const int bytes = kDesktopTileSize * static_cast<int>(sizeof(QRgb));
+  const int offset = tileIndex(value) * bytes;
+
+  for (int row = 0; row < kDesktopTileSize; row++) {
+    std::memcpy(canvas.scanLine(y + row) + x * sizeof(QRgb),
+                atlas.constScanLine(row) + offset, bytes);
+  }
+  counters.tiles++;
+}
+
+void s21::QtView::drawMatrix(QtElement& element, int** matrix) {
+  QRect box = dataRect(element);
+
+  for (int i = 0; i < element.height; i++) {
+    int y = box.top() + i * kDesktopTileSize;
+    int runStart = -1;
+    // Соседние изменившиеся клетки строки объединяются в один прямоугольник.
+    for (int j = 0; j <= element.width; j++) {
+      bool changed = false;
+      if (j < element.width) {
+        int value = tileIndex(matrix[i][j]);
+        int& drawn = element.shadow[i * element.width + j];
+        changed = drawn != value;
+        if (changed) {
+          blitTile(box.left() + j * kDesktopTileSize, y, value);
+          drawn = value;
+        }
+      }
+      if (changed && runStart < 0) runStart = j;
+      if (!changed && runStart >= 0) {
+        pending += QRect(box.left() + runStart * kDesktopTileSize, y,
+                         (j - runStart) * kDesktopTileSize, kDesktopTileSize);
+        runStart = -1;
+      }
+    }
+  }
+}
+
+// Нарисованные значения элемента (копия shadow и text) повторно выводятся
+// в стертой области, поэтому копия остается равной содержимому буфера.
+void s21::QtView::restoreData(const QtElement& element,
+                              const QRegion& erased) {
+  QRect box = dataRect(element);
+  if (!erased.intersects(box)) return;
+
+  if (element.type != DATA_TYPE_INT2D) {
+    if (!element.text.empty()) paintText(element);
+    return;
+  }
+  for (int i = 0; i < element.height; i++) {
+    for (int j = 0; j < element.width; j++) {
+      int value = element.shadow[i * element.width + j];
+      QRect cell(box.left() + j * kDesktopTileSize,
+                 box.top() + i * kDesktopTileSize, kDesktopTileSize,
+                 kDesktopTileSize);
+      if (value < 0 || !erased.intersects(cell)) continue;
+      blitTile(cell.left(), cell.top(), value);
+      pending += cell;
+    }
+  }
+}
+
+s21::QtElement* s21::QtView::findElement(int handle) {
+  if (handle < 0) return nullptr;
+
+  int slot = VIEW_HANDLE_SLOT(handle);
+  if (slot >= kDesktopMaxElements) return nullptr;
+
+  QtElement* element = &elements[slot];
+  if (!element->used || element->generation != VIEW_HANDLE_GENERATION(handle))
+    return nullptr;
+
+  return element;
+}
+
+int s21::QtView::addElement(int type, int top, int left, int width,
+                            int height, const char* label) {
+  if (width < 1 || height < 1) return VIEW_NO_HANDLE;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto slot = std::find_if(elements.begin(), elements.end(),
+                           [](const QtElement& e) { return !e.used; });
+  if (slot == elements.end()) return VIEW_NO_HANDLE;
+
+  QtElement& element = *slot;
+  element.used = true;
+  element.type = type;
+  element.top = std::max(top, 0);
+  element.left = std::max(left, 0);
+  element.width = width;
+  element.height = height;
+  element.label = label ? std::string(label).substr(0, kDesktopLabelSize - 1)
+                        : std::string();
+  element.shadow.assign(
+      type == DATA_TYPE_INT2D ? static_cast<std::size_t>(width * height) : 0,
+      -1);
+  element.text.clear();
+  growCanvas(frameRect(element).united(dataRect(element)));
+  drawFrame(element, false);
+
+  return VIEW_HANDLE(slot - elements.begin(), element.generation);
+}
+
+void s21::QtView::deleteElement(int handle) {
+  std::lock_guard<std::mutex> lock(mutex);
+  QtElement* element = findElement(handle);
+  if (!element) return;
+
+  QRegion erased(frameRect(*element));
+  drawFrame(*element, true);
+  element->used = false;
+  element->generation = (element->generation + 1) & VIEW_GENERATION_MASK;
+  element->shadow.clear();
+  element->text.clear();
+
+  // Рамки и данные соседних элементов могли перекрываться с удаленной:
+  // рамки рисуются заново, затем поверх них — данные под стертой областью
+  // и под линиями и подписями перерисованных рамок.
+  QRegion damaged = erased;
+  for (const QtElement& other : elements) {
+    if (!other.used || !erased.intersects(frameRect(other))) continue;
+    drawFrame(other, false);
+    damaged += QRegion(frameRect(other)).subtracted(dataRect(other));
+  }
+  for (const QtElement& other : elements) {
+    if (other.used) restoreData(other, damaged);
+  }
+}
+
+void s21::QtView::refreshElemenet(int handle, int datatype, void* data) {
+  std::lock_guard<std::mutex> lock(mutex);
+  QtElement* element = findElement(handle);
+  if (!element || !data || element->type != datatype) return;
+
+  char text[kDesktopTextSize];
+
+  switch (datatype) {
+    case DATA_TYPE_INT:
+      std::snprintf(text, sizeof(text), "%i", *static_cast<int*>(data));
+      drawText(*element, text);
+      break;
+    case DATA_TYPE_INT2D:
+      drawMatrix(*element, static_cast<int**>(data));
+      break;
+    case DATA_TYPE_CHAR:
+      text[0] = *static_cast<char*>(data);
+      text[1] = '\0';
+      drawText(*element, text);
+      break;
+    case DATA_TYPE_STR:
+      std::snprintf(text, sizeof(text), "%s", static_cast<char*>(data));
+      drawText(*element, text);
+      break;
+    default:
+      break;
+  }
+}
+
+void s21::QtView::render() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.frames++;
+    dirty += pending;
+    pending = QRegion();
+  }
+
+  // update() вызывается только в потоке виджета; повторные вызовы render()
+  // до обработки очереди объединяются в одну передачу изменений.
+  if (QThread::currentThread() == thread()) {
+    flushDirty();
+  } else if (!flushQueued.exchange(true)) {
+    QMetaObject::invokeMethod(
+        this, [this] { flushDirty(); }, Qt::QueuedConnection);
+  }
+}
+
+void s21::QtView::flushDirty() {
+  flushQueued = false;
+
+  QRegion region;
+  bool grown = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    region.swap(dirty);
+    std::swap(grown, resized);
+  }
+
+  // Изменение макета (добавление элементов) меняет масштаб всего окна.
+  if (grown) {
+    updateGeometry();
+    placeCanvas();
+    update();
+    return;
+  }
+
+  unsigned long updates = 0;
+  unsigned long long pixels = 0;
+  for (const QRect& rect : region) {
+    QRect target = toWidget(rect).intersected(this->rect());
+    if (target.isEmpty()) continue;
+    update(target);
+    updates++;
+    pixels += static_cast<unsigned long long>(target.width()) *
+              static_cast<unsigned long long>(target.height());
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  counters.updates += updates;
+  counters.pixels += pixels;
+}
+
+void s21::QtView::placeCanvas() {
+  QSize size;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    size = canvas.size();
+  }
+
+  scale = 1.0;
+  origin = QPoint();
+  if (size.isEmpty() || width() <= 0 || height() <= 0) return;
+
+  scale = std::min(static_cast<double>(width()) / size.width(),
+                   static_cast<double>(height()) / size.height());
+  origin = QPoint((width() - static_cast<int>(size.width() * scale)) / 2,
+                  (height() - static_cast<int>(size.height() * scale)) / 2);
+}
+
+// Прямоугольник буфера в координатах окна (с захватом частичных пикселей).
+QRect s21::QtView::toWidget(const QRect& rect) const {
+  int left = static_cast<int>(std::floor(rect.left() * scale));
+  int top = static_cast<int>(std::floor(rect.top() * scale));
+  int right = static_cast<int>(std::ceil((rect.right() + 1) * scale));
+  int bottom = static_cast<int>(std::ceil((rect.bottom() + 1) * scale));
+
+  return QRect(origin + QPoint(left, top),
+               origin + QPoint(right - 1, bottom - 1));
+}
+
+// Прямоугольник окна в координатах буфера (с захватом частичных пикселей).
+QRect s21::QtView::toCanvas(const QRect& rect) const {
+  QPoint start = rect.topLeft() - origin;
+  QPoint end = rect.bottomRight() + QPoint(1, 1) - origin;
+  int left = static_cast<int>(std::floor(start.x() / scale));
+  int top = static_cast<int>(std::floor(start.y() / scale));
+  int right = static_cast<int>(std::ceil(end.x() / scale));
+  int bottom = static_cast<int>(std::ceil(end.y() / scale));
+
+  return QRect(QPoint(left, top), QPoint(right - 1, bottom - 1));
+}
+
+void s21::QtView::paintEvent(QPaintEvent* event) {
+  QPainter painter(this);
+  std::lock_guard<std::mutex> lock(mutex);
+
+  QRect target = canvas.isNull() ? QRect() : toWidget(canvas.rect());
+  for (const QRect& rect : event->region().subtracted(target)) {
+    painter.fillRect(rect, kBackground);
+  }
+  if (canvas.isNull()) return;
+
+  // Копируются только запрошенные части буфера; границы частей округлены
+  // наружу, лишние пиксели отсекаются областью перерисовки.
+  for (const QRect& rect : event->region()) {
+    QRect source = toCanvas(rect).intersected(canvas.rect());
+    if (!source.isEmpty()) painter.drawImage(toWidget(source), canvas, source);
+  }
+}
+
+void s21::QtView::resizeEvent(QResizeEvent* event) {
+  QWidget::resizeEvent(event);
+  placeCanvas();
+}
+
+QSize s21::QtView::sizeHint() const {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  return canvas.isNull() ? QWidget::sizeHint() : canvas.size();
+}
+
+s21::QtViewStats s21::QtView::stats() const {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  return counters;
+}
+
+QImage s21::QtView::backingStore() const {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  return canvas.copy();
+}
+
+QImage s21::QtView::tile(int value) const {
+  return atlas.copy(tileIndex(value) * kDesktopTileSize, 0, kDesktopTileSize,
+                    kDesktopTileSize);
+}
@@ -1,29 +1,174 @@
+/*!
+  \file dsk_presenter.hpp
+  \author provemet
+  \version 2
+  \date Октябрь 2026
+  \brief Заголовочный файл представления игр BrickGames на Qt
+
+  \details Представление рисует элементы интерфейса в постоянный буфер
+  изображения (QImage) размером с макет интерфейса: рамки и подписи
+  рисуются один раз при добавлении элемента, текст — при изменении, а
+  клетки матриц копируются построчно из заранее отрисованного атласа тайлов
+  (по одному тайлу на цвет клетки). Для каждого элемента хранится копия
+  нарисованных значений, поэтому обновление перерисовывает только
+  изменившиеся клетки и накапливает их прямоугольники в области изменений.
+  Удаление элемента стирает его рамку и восстанавливает по копиям рамки и
+  данные перекрывавшихся с ней элементов.
+
+  Метод render() передает область изменений виджету вызовами update(QRect)
+  для каждого ее прямоугольника, пересчитанного в масштаб окна, поэтому
+  перерисовка окна ограничена изменившимися клетками. paintEvent() копирует
+  в окно только запрошенные прямоугольники буфера с масштабированием.
+
+  Методы ViewInterface можно вызывать из потока контроллера: буфер и
+  элементы защищены мьютексом, а обращения к виджету (update()) выполняются
+  в потоке виджета через очередь событий. Представление работает без
+  дисплея с платформой QT_QPA_PLATFORM=offscreen.
+*/
+
 #pragma once
 
-#include "../view/view.h"
+#include <QFont>
+#include <QImage>
+#include <QRegion>
 #include <QWidget>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../view/view.hpp"
+
+namespace s21 {
+
+/*!
+  \brief Максимальное количество элементов представления
+*/
+constexpr int kDesktopMaxElements = 16;
+
+/*!
+  \brief Размер клетки матрицы в буфере изображения, пиксели
+  \details Клетка занимает два знакоместа макета по горизонтали и одно по
+  вертикали, как в терминальных представлениях.
+*/
+constexpr int kDesktopTileSize = 24;
+
+/*!
+  \brief Размер знакоместа макета в буфере изображения, пиксели
+*/
+constexpr int kDesktopCharWidth = kDesktopTileSize / 2;
+constexpr int kDesktopCharHeight = kDesktopTileSize;
+
+/*!
+  \brief Количество тайлов атласа (цвет 0 — пустая клетка)
+  \details Значения клеток за пределами атласа рисуются последним тайлом.
+*/
+constexpr int kDesktopTileColors = 8;
 
-typedef struct QtElement_t {
-    int top;
-    int left;
-    int width;
-    int height;
-    bool isDirty;
-} QtElement_t;
+/*!
+  \brief Максимальная длина подписи и текста элемента
+*/
+constexpr std::size_t kDesktopLabelSize = 16;
+constexpr std::size_t kDesktopTextSize = 32;
 
+/*!
+  \brief Статистика вывода представления Qt
+*/
+struct QtViewStats {
+  unsigned long frames = 0;       ///< Количество вызовов render()
+  unsigned long tiles = 0;        ///< Количество скопированных тайлов
+  unsigned long updates = 0;      ///< Количество вызовов update(QRect)
+  unsigned long long pixels = 0;  ///< Площадь запрошенной перерисовки окна
+};
+
+/*!
+  \brief Элемент представления Qt
+*/
+struct QtElement {
+  bool used = false;        ///< Признак занятой ячейки
+  unsigned generation = 0;  ///< Поколение ячейки (см. VIEW_HANDLE)
+  int type = 0;             ///< Тип данных элемента
+  int top = 0;              ///< Строка рамки, знакоместа
+  int left = 0;             ///< Столбец рамки, знакоместа
+  int width = 0;            ///< Ширина, клетки матрицы
+  int height = 0;           ///< Высота, строки
+  std::string label;        ///< Подпись рамки
+  std::vector<int> shadow;  ///< Нарисованные значения клеток (-1 — нет)
+  std::string text;         ///< Нарисованный текст
+};
+
+/*!
+  \brief Представление игр BrickGame на Qt
+  \details Реализация ViewInterface в виде виджета. Макет элементов задается
+  в знакоместах, как для терминальных представлений, и масштабируется под
+  размер окна с сохранением пропорций.
+*/
 class QtView : public QWidget, public ViewInterface {
-    Q_OBJECT
+  Q_OBJECT
+
+ public:
+  explicit QtView(QWidget* parent = nullptr);
+  ~QtView() override = default;
+
+  int addElement(int type, int top, int left, int width, int height,
+                 const char* label) override;
+  void deleteElement(int handle) override;
+  void refreshElemenet(int handle, int datatype, void* data) override;
+  void render() override;
+
+  QSize sizeHint() const override;
+
+  /*!
+    \brief Возвращает статистику вывода.
+  */
+  QtViewStats stats() const;
+
+  /*!
+    \brief Возвращает копию буфера изображения.
+  */
+  QImage backingStore() const;
+
+  /*!
+    \brief Возвращает тайл атласа для значения клетки.
+  */
+  QImage tile(int value) const;
+
+ protected:
+  void paintEvent(QPaintEvent* event) override;
+  void resizeEvent(QResizeEvent* event) override;
+
+ private:
+  void buildAtlas();
+  void growCanvas(const QRect& bounds);
+  void drawFrame(const QtElement& element, bool erase);
+  void drawText(QtElement& element, const std::string& text);
+  void paintText(const QtElement& element);
+  void drawMatrix(QtElement& element, int** matrix);
+  void restoreData(const QtElement& element, const QRegion& erased);
+  void blitTile(int x, int y, int value);
+  void flushDirty();
+  void placeCanvas();
+  QtElement* findElement(int handle);
+  QRect frameRect(const QtElement& element) const;
+  QRect dataRect(const QtElement& element) const;
+  QRect toWidget(const QRect& rect) const;
+  QRect toCanvas(const QRect& rect) const;
 
-public:
-    QtView(QWidget *parent = nullptr);
-    void addElement(int top, int left, int width, int height) override;
-    void updateElement(int index, int top, int left) override;
-    void render() override;
+  mutable std::mutex mutex;  ///< Защищает элементы, буфер и статистику
+  std::array<QtElement, kDesktopMaxElements> elements;
+  QImage canvas;         ///< Буфер изображения макета
+  QImage atlas;          ///< Атлас тайлов клеток
+  QFont textFont;        ///< Шрифт подписей и текста
+  QRegion pending;       ///< Изменения буфера до вызова render()
+  QRegion dirty;         ///< Изменения, переданные виджету render()
+  bool resized = false;  ///< Признак изменения размера буфера
+  QtViewStats counters;  ///< Статистика вывода
+  std::atomic<bool> flushQueued{false};  ///< Передача изменений в очереди
 
-protected:
-    void paintEvent(QPaintEvent *event) override;
+  // Используются только в потоке виджета.
+  double scale = 1.0;  ///< Масштаб буфера в окне
+  QPoint origin;       ///< Положение буфера в окне
+};
 
-private:
-    QtElement_t* elements
-    std::vector<QtElement> elements;
-};
\ No newline at end of file
+}  // namespace s21
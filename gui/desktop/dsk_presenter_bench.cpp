@@ -0,0 +1,108 @@
+/*!
+  \file dsk_presenter_bench.cpp
+  \author provemet
+  \version 2
+  \date Октябрь 2026
+  \brief Замер времени кадра представления Qt
+
+  \details Окно 1920x1080 показывает буфер изображения с масштабированием.
+  Кадр — обновление поля с падающей фигурой и счета, render() и обработка
+  очереди событий, в которой окно перерисовывает запрошенные
+  прямоугольники. Для сравнения измеряется перерисовка всего окна (как при
+  изменении размера). Выводятся медиана, наименьшее и наибольшее время
+  кадра, мкс.
+*/
+
+#include <QApplication>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "dsk_presenter.hpp"
+
+namespace {
+
+constexpr int kFieldWidth = 10;
+constexpr int kFieldHeight = 20;
+constexpr int kWarmupFrames = 60;
+constexpr int kFrames = 600;
+
+using Clock = std::chrono::steady_clock;
+
+// Матрица в формате GameInfo_t::field (массив указателей на строки).
+struct Matrix {
+  std::vector<int> cells;
+  std::vector<int*> rows;
+
+  Matrix(int width, int height) : cells(width * height), rows(height) {
+    for (int i = 0; i < height; i++) rows[i] = &cells[i * width];
+  }
+  int** data() { return rows.data(); }
+};
+
+struct Scene {
+  s21::QtView view;
+  Matrix matrix{kFieldWidth, kFieldHeight};
+  int points = 0;
+  int field = VIEW_NO_HANDLE;
+  int score = VIEW_NO_HANDLE;
+
+  Scene() {
+    field = view.addElement(DATA_TYPE_INT2D, 0, 0, kFieldWidth, kFieldHeight,
+                            "FIELD");
+    score = view.addElement(DATA_TYPE_INT, 6, 25, 8, 1, "SCORE");
+    view.resize(1920, 1080);
+    view.show();
+    view.render();
+    QApplication::processEvents();
+  }
+
+  // Кадр игры: клетка фигуры переходит в следующую строку.
+  void frame(int index) {
+    int row = index % kFieldHeight;
+    int column = index / kFieldHeight % kFieldWidth;
+    if (row > 0) matrix.rows[row - 1][column] = 0;
+    matrix.rows[row][column] = 1 + index % 7;
+    points = index;
+    view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+    view.refreshElemenet(score, DATA_TYPE_INT, &points);
+    view.render();
+    QApplication::processEvents();
+  }
+
+  void fullRepaint(int) { view.repaint(); }
+};
+
+template <typename Step>
+void measure(const char* name, Step step) {
+  std::vector<double> samples(kFrames);
+
+  for (int i = 0; i < kWarmupFrames; i++) step(i);
+  for (int i = 0; i < kFrames; i++) {
+    Clock::time_point start = Clock::now();
+    step(kWarmupFrames + i);
+    samples[i] = std::chrono::duration<double, std::micro>(Clock::now() -
+                                                           start)
+                     .count();
+  }
+
+  std::sort(samples.begin(), samples.end());
+  std::printf("%-24s %10.1f us/frame  min %8.1f  max %8.1f  x%d\n", name,
+              samples[kFrames / 2], samples.front(), samples.back(), kFrames);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+  QApplication application(argc, argv);
+  Scene scene;
+
+  measure("frame_1920x1080", [&scene](int i) { scene.frame(i); });
+  measure("full_repaint_1920x1080", [&scene](int i) { scene.fullRepaint(i); });
+
+  return 0;
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <QApplication>
+#include <algorithm>
+#include <vector>
+
+#include "dsk_presenter.hpp"
+
+namespace {
+
+constexpr int kFieldWidth = 10;
+constexpr int kFieldHeight = 20;
+
+// Матрица в формате GameInfo_t::field (массив указателей на строки).
+struct Matrix {
+  std::vector<int> cells;
+  std::vector<int*> rows;
+
+  Matrix(int width, int height) : cells(width * height), rows(height) {
+    for (int i = 0; i < height; i++) rows[i] = &cells[i * width];
+  }
+  int** data() { return rows.data(); }
+};
+
+class QtViewTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    field = view.addElement(DATA_TYPE_INT2D, 0, 0, kFieldWidth, kFieldHeight,
+                            "FIELD");
+    score = view.addElement(DATA_TYPE_INT, 6, 25, 8, 1, "SCORE");
+    // Масштабированное окно больше буфера.
+    view.resize(1920, 1080);
+    view.show();
+    view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+    view.refreshElemenet(score, DATA_TYPE_INT, &points);
+    view.render();
+    QApplication::processEvents();
+  }
+
+  s21::QtView view;
+  Matrix matrix{kFieldWidth, kFieldHeight};
+  int points = 0;
+  int field = VIEW_NO_HANDLE;
+  int score = VIEW_NO_HANDLE;
+};
+
+TEST_F(QtViewTest, HandlesFollowSlots) {
+  EXPECT_EQ(field, VIEW_HANDLE(0, 0));
+  EXPECT_EQ(score, VIEW_HANDLE(1, 0));
+
+  view.deleteElement(score);
+  int next = view.addElement(DATA_TYPE_INT, 6, 25, 8, 1, "SCORE");
+  EXPECT_EQ(next, VIEW_HANDLE(1, 1));
+  view.render();
+
+  // Дескриптор удаленного элемента не принимается.
+  s21::QtViewStats before = view.stats();
+  view.refreshElemenet(score, DATA_TYPE_INT, &points);
+  view.render();
+  EXPECT_EQ(view.stats().updates, before.updates);
+}
+
+TEST_F(QtViewTest, UnchangedFrameRequestsNoRepaint) {
+  s21::QtViewStats before = view.stats();
+
+  view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+  view.refreshElemenet(score, DATA_TYPE_INT, &points);
+  view.render();
+
+  s21::QtViewStats after = view.stats();
+  EXPECT_EQ(after.frames, before.frames + 1);
+  EXPECT_EQ(after.tiles, before.tiles);
+  EXPECT_EQ(after.updates, before.updates);
+}
+
+TEST_F(QtViewTest, ChangedCellRepaintsOnlyItsTile) {
+  s21::QtViewStats before = view.stats();
+
+  matrix.rows[5][3] = 4;
+  view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+  view.render();
+
+  s21::QtViewStats after = view.stats();
+  EXPECT_EQ(after.tiles, before.tiles + 1);
+  EXPECT_EQ(after.updates, before.updates + 1);
+  // Площадь перерисовки — масштабированный тайл, а не окно.
+  unsigned long long area = after.pixels - before.pixels;
+  EXPECT_GT(area, 0u);
+  EXPECT_LT(area, static_cast<unsigned long long>(view.width()) *
+                      static_cast<unsigned long long>(view.height()) / 100);
+
+  // Клетка в буфере скопирована из тайла атласа своего цвета.
+  QImage tile = view.tile(4);
+  QImage canvas = view.backingStore();
+  int x = s21::kDesktopCharWidth + 3 * s21::kDesktopTileSize;
+  int y = s21::kDesktopCharHeight + 5 * s21::kDesktopTileSize;
+  EXPECT_EQ(canvas.copy(x, y, tile.width(), tile.height()), tile);
+}
+
+TEST_F(QtViewTest, TextChangeRepaintsTextArea) {
+  s21::QtViewStats before = view.stats();
+
+  points = 1500;
+  view.refreshElemenet(score, DATA_TYPE_INT, &points);
+  view.render();
+
+  s21::QtViewStats after = view.stats();
+  EXPECT_EQ(after.tiles, before.tiles);
+  EXPECT_EQ(after.updates, before.updates + 1);
+}
+
+TEST_F(QtViewTest, FallingPieceRepaintsOnlyChangedCells) {
+  constexpr int kFrames = 600;
+  s21::QtViewStats before = view.stats();
+
+  for (int frame = 0; frame < kFrames; frame++) {
+    // Падающая фигура: клетка появляется в новой строке и исчезает в
+    // предыдущей, в первой строке столбца меняется одна клетка.
+    int row = frame % kFieldHeight;
+    int column = frame / kFieldHeight % kFieldWidth;
+    if (row > 0) matrix.rows[row - 1][column] = 0;
+    matrix.rows[row][column] = 1 + frame % 7;
+    points = frame;
+    view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+    view.refreshElemenet(score, DATA_TYPE_INT, &points);
+    view.render();
+    QApplication::processEvents();
+  }
+
+  s21::QtViewStats after = view.stats();
+  EXPECT_EQ(after.frames, before.frames + kFrames);
+  EXPECT_EQ(after.tiles, before.tiles + 2 * kFrames - kFrames / kFieldHeight);
+
+  // Кадр перерисовывает не больше двух клеток и поля счета в масштабе окна
+  // (границы округляются наружу на пиксель).
+  QSize canvas = view.backingStore().size();
+  double scale =
+      std::min(static_cast<double>(view.width()) / canvas.width(),
+               static_cast<double>(view.height()) / canvas.height());
+  double tile = s21::kDesktopTileSize * scale + 2;
+  double text = (8 * s21::kDesktopTileSize * scale + 2) *
+                (s21::kDesktopCharHeight * scale + 2);
+  EXPECT_LE(static_cast<double>(after.pixels - before.pixels),
+            kFrames * (2 * tile * tile + text));
+}
+
+TEST_F(QtViewTest, DeleteRestoresOverlappedElements) {
+  for (int i = 0; i < kFieldHeight; i++)
+    for (int j = 0; j < kFieldWidth; j++) matrix.rows[i][j] = 1 + (i + j) % 7;
+  view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+  view.render();
+  QImage expected = view.backingStore();
+
+  // Всплывающий элемент целиком лежит поверх клеток поля.
+  int popup = view.addElement(DATA_TYPE_STR, 3, 4, 3, 1, "PAUSE");
+  char text[] = "paused";
+  view.refreshElemenet(popup, DATA_TYPE_STR, text);
+  view.render();
+  ASSERT_NE(view.backingStore(), expected);
+
+  view.deleteElement(popup);
+  view.render();
+  EXPECT_EQ(view.backingStore(), expected);
+
+  // Копия нарисованных значений совпадает с буфером: повтор кадра не
+  // копирует тайлов.
+  s21::QtViewStats before = view.stats();
+  view.refreshElemenet(field, DATA_TYPE_INT2D, matrix.data());
+  view.render();
+  EXPECT_EQ(view.stats().tiles, before.tiles);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // Тесты не требуют дисплея.
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+  QApplication application(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
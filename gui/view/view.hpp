@@ -1,5 +1,7 @@
 #pragma once
 
+#include "view_types.h"
+
 #define FRAME_NAME_1 NULL
 #define FRAME_NAME_2 "NEXT"
 #define FRAME_NAME_3 "SCORE"
@@ -28,13 +30,17 @@ namespace s21 {
    представления и предоставляет возможность не реализовывать условную
    компиляцию и другие методы при сборке программы, независимо от вида
    представления
+
+    Метод addElement() возвращает дескриптор элемента (VIEW_HANDLE) или
+   VIEW_NO_HANDLE. Дескриптор не меняется при удалении других элементов и
+   становится недействительным после удаления своего элемента.
 */
 class ViewInterface {
  public:
   virtual ~ViewInterface() = default;
-  virtual void addElement(int type, int top, int left, int width, int height, char* label) = 0;
-  virtual void deleteElement(int index) = 0;
-  virtual void refreshElemenet(int index, int datatype, void* data) = 0;
+  virtual int addElement(int type, int top, int left, int width, int height, const char* label) = 0;
+  virtual void deleteElement(int handle) = 0;
+  virtual void refreshElemenet(int handle, int datatype, void* data) = 0;
   virtual void render() = 0;
 };
 
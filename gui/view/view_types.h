@@ -0,0 +1,75 @@
+/*!
+  \file view_types.h
+  \author provemet
+  \version 2
+  \date Октябрь 2026
+  \brief Общие определения представлений игр BrickGames
+
+  \details Файл содержит определения, общие для всех реализаций представления
+  (ncurses, ANSI): типы данных элементов интерфейса, передаваемые
+  контроллером через ViewInterface, и дескрипторы элементов.
+
+  Дескриптор элемента объединяет номер ячейки хранилища элементов и
+  поколение ячейки. Поколение увеличивается при удалении элемента, поэтому
+  дескриптор удаленного элемента не принимается, даже если его ячейка уже
+  занята новым элементом. Ячейки занимаются по возрастанию номеров, поэтому
+  дескрипторы элементов, добавленных подряд в пустое представление, равны
+  0, 1, 2...
+*/
+
+#ifndef VIEW_TYPES_H
+#define VIEW_TYPES_H
+
+/*!
+  \brief Перечисление типов данных элемента
+  \details Перечисление используется в определении типа данных элемента
+  интерфейса, а также в функции обновления изображения.
+*/
+typedef enum DataType {
+  DATA_TYPE_INT,    ///< Целое число
+  DATA_TYPE_INT1D,  ///< Одномерный массив целых чисел
+  DATA_TYPE_INT2D,  ///< Двумерный массив (матрица)
+  DATA_TYPE_CHAR,   ///< Символ
+  DATA_TYPE_STR     ///< Строка
+} DataType;
+
+/*!
+  \brief Количество бит номера ячейки в дескрипторе элемента
+*/
+#define VIEW_HANDLE_SLOT_BITS 8
+
+/*!
+  \brief Маска номера ячейки в дескрипторе элемента
+*/
+#define VIEW_HANDLE_SLOT_MASK ((1 << VIEW_HANDLE_SLOT_BITS) - 1)
+
+/*!
+  \brief Маска поколения ячейки (поколение хранится по модулю 2^16)
+*/
+#define VIEW_GENERATION_MASK 0xffff
+
+/*!
+  \brief Недействительный дескриптор элемента (ошибка добавления)
+*/
+#define VIEW_NO_HANDLE (-1)
+
+/*!
+  \brief Формирует дескриптор элемента из номера ячейки и поколения
+*/
+#define VIEW_HANDLE(slot, generation)                                   \
+  ((int)((((unsigned)(generation) & VIEW_GENERATION_MASK)               \
+          << VIEW_HANDLE_SLOT_BITS) |                                   \
+         ((unsigned)(slot) & VIEW_HANDLE_SLOT_MASK)))
+
+/*!
+  \brief Номер ячейки дескриптора
+*/
+#define VIEW_HANDLE_SLOT(handle) ((handle) & VIEW_HANDLE_SLOT_MASK)
+
+/*!
+  \brief Поколение ячейки дескриптора
+*/
+#define VIEW_HANDLE_GENERATION(handle) \
+  (((unsigned)(handle) >> VIEW_HANDLE_SLOT_BITS) & VIEW_GENERATION_MASK)
+
+#endif
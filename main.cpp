@@ -1,7 +1,71 @@
 #include "./controller/gamectrl.hpp"
+#include "./brick_game/common/work_pool.h"
+#if defined(BRICKGAME_GUI_ANSI)
+#include "./gui/ansi/ansi_wraper.hpp"
+#elif defined(BRICKGAME_GUI_CLI)
+#include "./gui/cli/cli_wraper.hpp"
+#else
+#error "Terminal interface is not selected (GUI_TYPE=cli or GUI_TYPE=ansi)"
+#endif
 #include <unistd.h>
 
-int main() {
-    s21::GameController controller;
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+#if defined(BRICKGAME_GUI_ANSI)
+using TerminalView = s21::AnsiViewWrapper;
+#else
+using TerminalView = s21::ConsoleViewWrapper;
+#endif
+
+void printUsage(const char* name) {
+    std::fprintf(stderr,
+                 "Usage: %s [--seed N] [--record FILE | --replay FILE] "
+                 "[--autoplay N]\n",
+                 name);
+}
+
+bool parseArguments(int argc, char** argv, s21::SessionOptions& options) {
+    if (argc % 2 == 0) return false;
+
+    for (int i = 1; i < argc; i += 2) {
+        const char* value = argv[i + 1];
+        char* end = nullptr;
+        if (!std::strcmp(argv[i], "--record")) {
+            options.recordPath = value;
+        } else if (!std::strcmp(argv[i], "--replay")) {
+            options.replayPath = value;
+        } else if (!std::strcmp(argv[i], "--autoplay")) {
+            long threads = std::strtol(value, &end, 10);
+            options.autoplay = *value != '\0' && *end == '\0' &&
+                               threads >= 0 && threads <= WORK_POOL_MAX_THREADS;
+            options.autoplayThreads = static_cast<int>(threads);
+            if (!options.autoplay) return false;
+        } else if (!std::strcmp(argv[i], "--seed")) {
+            options.seed = std::strtoull(value, &end, 10);
+            options.hasSeed = *value != '\0' && *end == '\0';
+            if (!options.hasSeed) return false;
+        } else {
+            return false;
+        }
+    }
+
+    return !(options.recordPath && options.replayPath);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    s21::SessionOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    TerminalView view;
+    s21::GameController controller(&view, options);
     return controller.run();
-}
\ No newline at end of file
+}
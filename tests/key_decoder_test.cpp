@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../controller/key_decoder.hpp"
+
+namespace {
+
+using s21::KeyEvent;
+
+const KeyEvent kHud{Start, s21::ControlKey::HudToggle};
+const KeyEvent kEscape{s21::kEscapeAction};
+
+// Вход разбит на буферы так, как их возвращает read().
+struct DecoderCase {
+    const char* name;
+    std::vector<std::string> reads;
+    std::vector<KeyEvent> expected;
+};
+
+const std::vector<DecoderCase> kCorpus = {
+    {"Enter", {"\n"}, {Start}},
+    {"CarriageReturn", {"\r"}, {Start}},
+    {"Keys", {"pq P"}, {Pause, Terminate, Action, Pause}},
+    {"UnknownKeys", {"xyz"}, {}},
+    {"HudToggle", {"hH"}, {kHud, kHud}},
+    {"CsiArrows", {"\x1b[A\x1b[B\x1b[C\x1b[D"}, {Up, Down, Right, Left}},
+    {"Ss3Arrows", {"\x1bOA\x1bOB\x1bOC\x1bOD"}, {Up, Down, Right, Left}},
+    {"Ss3KeypadEnter", {"\x1bOM"}, {Start}},
+    {"CsiWithModifier", {"\x1b[1;5C"}, {Right}},
+    {"LoneEscape", {"\x1b"}, {kEscape}},
+    {"DoubleEscape", {"\x1b\x1b"}, {kEscape, kEscape}},
+    {"EscapeThenKey", {"\x1bq"}, {kEscape, Terminate}},
+    {"EscapeThenArrow", {"\x1b\x1b[A"}, {kEscape, Up}},
+    {"EscapeAtBufferEnd", {"\x1b", "[A"}, {kEscape}},
+    {"CsiSplitAcrossReads", {"\x1b[", "D"}, {Left}},
+    {"CsiParamsSplit", {"\x1b[1;", "5A"}, {Up}},
+    {"Ss3Split", {"\x1bO", "B"}, {Down}},
+    {"UnknownCsiSkipped", {"\x1b[2~ "}, {Action}},
+    {"UnknownSs3Skipped", {"\x1bOP\n"}, {Start}},
+    {"CsiInterruptedByEscape", {"\x1b[1\x1b[C"}, {Right}},
+    {"OverlongCsiSkipped", {"\x1b[11111111111111111111A "}, {Action}},
+    {"RepeatedArrows", {"\x1b[D\x1b[D\x1b[D"}, {Left, Left, Left}},
+};
+
+std::vector<KeyEvent> decodeAll(const DecoderCase& decoderCase) {
+    s21::KeyDecoder decoder;
+    std::vector<KeyEvent> events;
+
+    for (const std::string& data : decoderCase.reads) {
+        std::vector<KeyEvent> decoded(data.size() + 1);
+        std::size_t count =
+            decoder.decode(data.data(), data.size(), decoded.data());
+        events.insert(events.end(), decoded.begin(), decoded.begin() + count);
+    }
+
+    return events;
+}
+
+}  // namespace
+
+TEST(KeyDecoderTest, Corpus) {
+    for (const DecoderCase& decoderCase : kCorpus) {
+        EXPECT_EQ(decodeAll(decoderCase), decoderCase.expected)
+            << "case " << decoderCase.name;
+    }
+}
+
+TEST(KeyDecoderTest, ResetDropsPartialSequence) {
+    s21::KeyDecoder decoder;
+    KeyEvent events[4];
+
+    EXPECT_EQ(decoder.decode("\x1b[", 2, events), 0u);
+    decoder.reset();
+    ASSERT_EQ(decoder.decode("A ", 2, events), 1u);
+    EXPECT_EQ(events[0], KeyEvent{Action});
+}